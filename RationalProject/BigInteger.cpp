@@ -0,0 +1,410 @@
+/**
+* File: BigInteger.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Implementation of the promoted (multi-limb) paths of BigInteger.
+* Magnitudes are stored as little-endian vectors of 32-bit limbs; the inline 64-bit paths live in the header.
+*/
+
+#include "BigInteger.h"
+#include "InvalidArgumentException.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace rational::exception;
+
+namespace rational {
+	namespace {
+		typedef std::vector<std::uint32_t> Limbs;
+
+		// compare two magnitudes, returning -1, 0 or 1
+		int compareMagnitude(const Limbs& a, const Limbs& b) {
+			if (a.size() != b.size()) {
+				return (a.size() < b.size()) ? -1 : 1;
+			}
+			for (std::size_t i = a.size(); i-- > 0;) {
+				if (a[i] != b[i]) {
+					return (a[i] < b[i]) ? -1 : 1;
+				}
+			}
+			return 0;
+		}
+
+		// strip leading zero limbs
+		void trim(Limbs& a) {
+			while (!a.empty() && a.back() == 0) {
+				a.pop_back();
+			}
+		}
+
+		// a + b
+		Limbs addMagnitude(const Limbs& a, const Limbs& b) {
+			const Limbs& longer = (a.size() >= b.size()) ? a : b;
+			const Limbs& shorter = (a.size() >= b.size()) ? b : a;
+			Limbs result(longer.size() + 1);
+			std::uint64_t carry = 0;
+			for (std::size_t i = 0; i < longer.size(); i++) {
+				std::uint64_t sum = (std::uint64_t)longer[i] + (i < shorter.size() ? shorter[i] : 0) + carry;
+				result[i] = (std::uint32_t)sum;
+				carry = sum >> 32;
+			}
+			result[longer.size()] = (std::uint32_t)carry;
+			trim(result);
+			return result;
+		}
+
+		// a - b, where a >= b
+		Limbs subtractMagnitude(const Limbs& a, const Limbs& b) {
+			Limbs result(a.size());
+			std::int64_t borrow = 0;
+			for (std::size_t i = 0; i < a.size(); i++) {
+				std::int64_t diff = (std::int64_t)a[i] - (i < b.size() ? b[i] : 0) - borrow;
+				borrow = (diff < 0) ? 1 : 0;
+				result[i] = (std::uint32_t)(diff + (borrow << 32));
+			}
+			trim(result);
+			return result;
+		}
+
+		// a * b (schoolbook)
+		Limbs multiplyMagnitude(const Limbs& a, const Limbs& b) {
+			if (a.empty() || b.empty()) {
+				return Limbs();
+			}
+			Limbs result(a.size() + b.size());
+			for (std::size_t i = 0; i < a.size(); i++) {
+				std::uint64_t carry = 0;
+				for (std::size_t j = 0; j < b.size(); j++) {
+					std::uint64_t product = (std::uint64_t)a[i] * b[j] + result[i + j] + carry;
+					result[i + j] = (std::uint32_t)product;
+					carry = product >> 32;
+				}
+				result[i + b.size()] = (std::uint32_t)carry;
+			}
+			trim(result);
+			return result;
+		}
+
+		// divide a by a single limb in place, returning the remainder
+		std::uint32_t divideBySmall(Limbs& a, const std::uint32_t divisor) {
+			std::uint64_t remainder = 0;
+			for (std::size_t i = a.size(); i-- > 0;) {
+				std::uint64_t current = (remainder << 32) | a[i];
+				a[i] = (std::uint32_t)(current / divisor);
+				remainder = current % divisor;
+			}
+			trim(a);
+			return (std::uint32_t)remainder;
+		}
+
+		// number of leading zero bits in a non-zero limb
+		int leadingZeros(std::uint32_t value) {
+			int count = 0;
+			while ((value & 0x80000000u) == 0) {
+				value <<= 1;
+				count++;
+			}
+			return count;
+		}
+
+		// long division of magnitudes (Knuth, TAOCP vol. 2, 4.3.1, algorithm D)
+		void divideMagnitude(const Limbs& a, const Limbs& b, Limbs& quotient, Limbs& remainder) {
+			if (compareMagnitude(a, b) < 0) {
+				quotient.clear();
+				remainder = a;
+				return;
+			}
+			if (b.size() == 1) {
+				quotient = a;
+				std::uint32_t r = divideBySmall(quotient, b[0]);
+				remainder.assign(1, r);
+				trim(remainder);
+				return;
+			}
+
+			// normalize so the top bit of the divisor is set
+			const int shift = leadingZeros(b.back());
+			const std::size_t n = b.size();
+			const std::size_t m = a.size() - n;
+			Limbs v(n);
+			Limbs u(a.size() + 1);
+			for (std::size_t i = n; i-- > 0;) {
+				v[i] = (b[i] << shift) | (shift != 0 && i > 0 ? b[i - 1] >> (32 - shift) : 0);
+			}
+			u[a.size()] = (shift != 0) ? a.back() >> (32 - shift) : 0;
+			for (std::size_t i = a.size(); i-- > 0;) {
+				u[i] = (a[i] << shift) | (shift != 0 && i > 0 ? a[i - 1] >> (32 - shift) : 0);
+			}
+
+			quotient.assign(m + 1, 0);
+			const std::uint64_t base = (std::uint64_t)1 << 32;
+			for (std::size_t j = m + 1; j-- > 0;) {
+				// estimate the quotient digit from the top two limbs
+				std::uint64_t numerator = ((std::uint64_t)u[j + n] << 32) | u[j + n - 1];
+				std::uint64_t qhat = numerator / v[n - 1];
+				std::uint64_t rhat = numerator % v[n - 1];
+				while (qhat >= base || qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2])) {
+					qhat--;
+					rhat += v[n - 1];
+					if (rhat >= base) {
+						break;
+					}
+				}
+
+				// multiply and subtract
+				std::int64_t borrow = 0;
+				std::uint64_t carry = 0;
+				for (std::size_t i = 0; i < n; i++) {
+					std::uint64_t product = qhat * v[i] + carry;
+					carry = product >> 32;
+					std::int64_t diff = (std::int64_t)u[i + j] - (std::int64_t)(product & 0xFFFFFFFFu) - borrow;
+					u[i + j] = (std::uint32_t)diff;
+					borrow = (diff < 0) ? 1 : 0;
+				}
+				std::int64_t diff = (std::int64_t)u[j + n] - (std::int64_t)carry - borrow;
+				u[j + n] = (std::uint32_t)diff;
+
+				// the estimate was one too large -- add the divisor back
+				if (diff < 0) {
+					qhat--;
+					std::uint64_t sum = 0;
+					for (std::size_t i = 0; i < n; i++) {
+						sum = (std::uint64_t)u[i + j] + v[i] + (sum >> 32);
+						u[i + j] = (std::uint32_t)sum;
+					}
+					u[j + n] += (std::uint32_t)(sum >> 32);
+				}
+				quotient[j] = (std::uint32_t)qhat;
+			}
+			trim(quotient);
+
+			// unnormalize the remainder
+			remainder.assign(n, 0);
+			for (std::size_t i = 0; i < n; i++) {
+				remainder[i] = (u[i] >> shift) | (shift != 0 ? u[i + 1] << (32 - shift) : 0);
+			}
+			trim(remainder);
+		}
+	}
+
+	// construct from a double, truncating toward zero
+	BigInteger::BigInteger(const double value) : small(0), negative(false) {
+		if (std::isnan(value) || std::isinf(value)) {
+			std::ostringstream ss;
+			ss << value;
+			throw InvalidArgumentException("Cannot convert a non-finite value to an integer", ss.str(), __FILE__, __LINE__);
+		}
+
+		double truncated = std::trunc(value);
+		if (std::fabs(truncated) < 9223372036854775808.0) {
+			small = (std::int64_t)truncated;
+			return;
+		}
+
+		// split |value| = mantissa * 2^exponent, with an integral 53-bit mantissa
+		int exponent;
+		double fraction = std::frexp(std::fabs(truncated), &exponent);
+		std::uint64_t mantissa = (std::uint64_t)std::ldexp(fraction, 53);
+		exponent -= 53;
+
+		// shift the mantissa into place
+		Limbs limbs(exponent / 32 + 3, 0);
+		std::size_t limbShift = exponent / 32;
+		int bitShift = exponent % 32;
+		limbs[limbShift] = (std::uint32_t)(mantissa << bitShift);
+		limbs[limbShift + 1] = (std::uint32_t)((mantissa << bitShift) >> 32);
+		limbs[limbShift + 2] = (std::uint32_t)(bitShift != 0 ? mantissa >> (64 - bitShift) : 0);
+
+		negative = value < 0;
+		magnitude = limbs;
+		normalize();
+	}
+
+#ifdef __SIZEOF_INT128__
+	// construct from a 128-bit integer -- promoted unless it fits in 64 bits
+	BigInteger::BigInteger(const __int128 value) : small(0), negative(false) {
+		if (value >= std::numeric_limits<std::int64_t>::min() && value <= std::numeric_limits<std::int64_t>::max()) {
+			small = (std::int64_t)value;
+			return;
+		}
+
+		// negate in unsigned arithmetic so the minimum value is handled
+		negative = value < 0;
+		unsigned __int128 bits = negative ? 0 - (unsigned __int128)value : (unsigned __int128)value;
+		for (int i = 0; i < 4; i++) {
+			magnitude.push_back((std::uint32_t)bits);
+			bits >>= 32;
+		}
+		normalize();
+	}
+#endif
+
+	// build a promoted value from a sign and an unsigned 64-bit magnitude
+	BigInteger BigInteger::fromMagnitude(const bool negative, const std::uint64_t value) {
+		BigInteger result;
+		result.negative = negative;
+		result.magnitude.push_back((std::uint32_t)value);
+		result.magnitude.push_back((std::uint32_t)(value >> 32));
+		result.normalize();
+		return result;
+	}
+
+	// get the sign and magnitude of either representation
+	void BigInteger::toParts(bool& isNegative, std::vector<std::uint32_t>& limbs) const {
+		if (isSmall()) {
+			isNegative = small < 0;
+			// negate in unsigned arithmetic so the minimum value is handled
+			std::uint64_t value = isNegative ? 0 - (std::uint64_t)small : (std::uint64_t)small;
+			limbs.clear();
+			limbs.push_back((std::uint32_t)value);
+			limbs.push_back((std::uint32_t)(value >> 32));
+			trim(limbs);
+		}
+		else {
+			isNegative = negative;
+			limbs = magnitude;
+		}
+	}
+
+	// strip leading zero limbs and demote to the inline representation if the value fits
+	void BigInteger::normalize() {
+		trim(magnitude);
+		if (magnitude.size() <= 2) {
+			std::uint64_t value = 0;
+			for (std::size_t i = magnitude.size(); i-- > 0;) {
+				value = (value << 32) | magnitude[i];
+			}
+			const std::uint64_t limit = (std::uint64_t)std::numeric_limits<std::int64_t>::max();
+			if (value <= limit || (negative && value == limit + 1)) {
+				small = negative ? (std::int64_t)(0 - value) : (std::int64_t)value;
+				negative = false;
+				magnitude.clear();
+			}
+		}
+	}
+
+	// signed addition (or subtraction) of magnitudes
+	BigInteger BigInteger::addSlow(const BigInteger& lhs, const BigInteger& rhs, const bool subtract) {
+		bool lhsNegative, rhsNegative;
+		Limbs a, b;
+		lhs.toParts(lhsNegative, a);
+		rhs.toParts(rhsNegative, b);
+		if (subtract) {
+			rhsNegative = !rhsNegative;
+		}
+
+		BigInteger result;
+		if (lhsNegative == rhsNegative) {
+			result.magnitude = addMagnitude(a, b);
+			result.negative = lhsNegative;
+		}
+		else if (compareMagnitude(a, b) >= 0) {
+			result.magnitude = subtractMagnitude(a, b);
+			result.negative = lhsNegative;
+		}
+		else {
+			result.magnitude = subtractMagnitude(b, a);
+			result.negative = rhsNegative;
+		}
+		result.normalize();
+		return result;
+	}
+
+	// signed multiplication of magnitudes
+	BigInteger BigInteger::multiplySlow(const BigInteger& lhs, const BigInteger& rhs) {
+		bool lhsNegative, rhsNegative;
+		Limbs a, b;
+		lhs.toParts(lhsNegative, a);
+		rhs.toParts(rhsNegative, b);
+
+		BigInteger result;
+		result.magnitude = multiplyMagnitude(a, b);
+		result.negative = lhsNegative != rhsNegative;
+		result.normalize();
+		return result;
+	}
+
+	// signed division of magnitudes -- the quotient truncates toward zero, the remainder takes the sign of the dividend
+	void BigInteger::divideSlow(const BigInteger& lhs, const BigInteger& rhs, BigInteger* quotient, BigInteger* remainder) {
+		if (rhs.sign() == 0) {
+			throw DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		bool lhsNegative, rhsNegative;
+		Limbs a, b, q, r;
+		lhs.toParts(lhsNegative, a);
+		rhs.toParts(rhsNegative, b);
+		divideMagnitude(a, b, q, r);
+
+		if (quotient != nullptr) {
+			*quotient = BigInteger();
+			quotient->magnitude = q;
+			quotient->negative = lhsNegative != rhsNegative;
+			quotient->normalize();
+		}
+		if (remainder != nullptr) {
+			*remainder = BigInteger();
+			remainder->magnitude = r;
+			remainder->negative = lhsNegative;
+			remainder->normalize();
+		}
+	}
+
+	// compare values when at least one is promoted
+	int BigInteger::compareSlow(const BigInteger& lhs, const BigInteger& rhs) {
+		bool lhsNegative, rhsNegative;
+		Limbs a, b;
+		lhs.toParts(lhsNegative, a);
+		rhs.toParts(rhsNegative, b);
+
+		if (lhsNegative != rhsNegative) {
+			return lhsNegative ? -1 : 1;
+		}
+		int result = compareMagnitude(a, b);
+		return lhsNegative ? -result : result;
+	}
+
+	// convert to the nearest double
+	double BigInteger::toDouble() const {
+		if (isSmall()) {
+			return (double)small;
+		}
+
+		double result = 0.0;
+		for (std::size_t i = magnitude.size(); i-- > 0;) {
+			result = result * 4294967296.0 + magnitude[i];
+		}
+		return negative ? -result : result;
+	}
+
+	// convert to a decimal std::string
+	std::string BigInteger::toString() const {
+		if (isSmall()) {
+			return std::to_string(small);
+		}
+
+		// peel off nine decimal digits at a time
+		Limbs limbs = magnitude;
+		std::string digits;
+		while (!limbs.empty()) {
+			std::uint32_t chunk = divideBySmall(limbs, 1000000000u);
+			for (int i = 0; i < 9 && (chunk != 0 || !limbs.empty()); i++) {
+				digits.push_back((char)('0' + chunk % 10));
+				chunk /= 10;
+			}
+		}
+		if (negative) {
+			digits.push_back('-');
+		}
+		std::reverse(digits.begin(), digits.end());
+		return digits;
+	}
+
+	// stream overload
+	std::ostream& operator<<(std::ostream& os, const BigInteger& value) {
+		os << value.toString();
+		return os;
+	}
+}
@@ -0,0 +1,292 @@
+/**
+* File: BigInteger.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This class provides an arbitrary-precision integer used as the numerator/denominator type of BigRational.
+* Values that fit in 64 bits are stored inline and use the native (overflow-checked) arithmetic, so the common case
+* never allocates. When an operation overflows, the result is transparently promoted to a magnitude of 32-bit limbs,
+* and it is demoted again as soon as it fits in 64 bits.
+*/
+
+#ifndef BIG_INTEGER_H
+#define BIG_INTEGER_H
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "IntegerTraits.h"
+#include "DivideByZeroException.h"
+
+namespace rational {
+	class BigInteger {
+	public:
+		// constructors
+		// zero
+		BigInteger();
+		// construct from any built-in integral value
+		template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+		BigInteger(const T value);
+#ifdef __SIZEOF_INT128__
+		// construct from a 128-bit integer
+		BigInteger(const __int128 value);
+#endif
+		// construct from a double, truncating toward zero
+		explicit BigInteger(const double value);
+
+		// arithmetic operators
+		BigInteger operator-() const;
+		BigInteger& operator+=(const BigInteger& other);
+		BigInteger& operator-=(const BigInteger& other);
+		BigInteger& operator*=(const BigInteger& other);
+		// division truncates toward zero, like the built-in integer division
+		BigInteger& operator/=(const BigInteger& other);
+		// the remainder has the sign of the dividend, like the built-in integer remainder
+		BigInteger& operator%=(const BigInteger& other);
+
+		friend BigInteger operator+(BigInteger lhs, const BigInteger& rhs) { return lhs += rhs; }
+		friend BigInteger operator-(BigInteger lhs, const BigInteger& rhs) { return lhs -= rhs; }
+		friend BigInteger operator*(BigInteger lhs, const BigInteger& rhs) { return lhs *= rhs; }
+		friend BigInteger operator/(BigInteger lhs, const BigInteger& rhs) { return lhs /= rhs; }
+		friend BigInteger operator%(BigInteger lhs, const BigInteger& rhs) { return lhs %= rhs; }
+
+		// comparison operators
+		friend bool operator==(const BigInteger& lhs, const BigInteger& rhs) { return compare(lhs, rhs) == 0; }
+		friend bool operator!=(const BigInteger& lhs, const BigInteger& rhs) { return compare(lhs, rhs) != 0; }
+		friend bool operator<(const BigInteger& lhs, const BigInteger& rhs) { return compare(lhs, rhs) < 0; }
+		friend bool operator<=(const BigInteger& lhs, const BigInteger& rhs) { return compare(lhs, rhs) <= 0; }
+		friend bool operator>(const BigInteger& lhs, const BigInteger& rhs) { return compare(lhs, rhs) > 0; }
+		friend bool operator>=(const BigInteger& lhs, const BigInteger& rhs) { return compare(lhs, rhs) >= 0; }
+
+		// return a negative value, zero, or a positive value if lhs is less than, equal to, or greater than rhs
+		static int compare(const BigInteger& lhs, const BigInteger& rhs);
+
+		// return true if the value is stored inline (fits in 64 bits)
+		bool isSmall() const;
+		// return -1, 0 or 1 depending on the sign of the value
+		int sign() const;
+
+		// conversions
+		// convert to the nearest double
+		double toDouble() const;
+		// convert to a decimal std::string
+		std::string toString() const;
+		// convert to a built-in integer type (including __int128) -- the value must fit in T
+		template<typename T>
+		T toIntegral() const;
+
+		// stream overload
+		friend std::ostream& operator<<(std::ostream& os, const BigInteger& value);
+
+	private:
+		std::int64_t small;  // the value, when it fits in 64 bits
+		bool negative;  // the sign of a promoted value
+		std::vector<std::uint32_t> magnitude;  // little-endian limbs of a promoted value -- empty when the value is small
+
+		// slow paths, taken when an operand is promoted or the native operation overflows
+		static BigInteger addSlow(const BigInteger& lhs, const BigInteger& rhs, const bool subtract);
+		static BigInteger multiplySlow(const BigInteger& lhs, const BigInteger& rhs);
+		static void divideSlow(const BigInteger& lhs, const BigInteger& rhs, BigInteger* quotient, BigInteger* remainder);
+		static int compareSlow(const BigInteger& lhs, const BigInteger& rhs);
+
+		// build a promoted value from a sign and an unsigned 64-bit magnitude
+		static BigInteger fromMagnitude(const bool negative, const std::uint64_t value);
+		// get the sign and magnitude of either representation
+		void toParts(bool& isNegative, std::vector<std::uint32_t>& limbs) const;
+		// strip leading zero limbs and demote to the inline representation if the value fits
+		void normalize();
+	};
+
+	// construct from a built-in integral value -- only unsigned values above the 64-bit signed range are promoted
+	template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type>
+	inline BigInteger::BigInteger(const T value) : small(0), negative(false) {
+		if (std::is_unsigned<T>::value && (std::uint64_t)value > (std::uint64_t)std::numeric_limits<std::int64_t>::max()) {
+			*this = fromMagnitude(false, (std::uint64_t)value);
+		}
+		else {
+			small = (std::int64_t)value;
+		}
+	}
+
+	// convert to a built-in integer type -- promoted values are rebuilt from the most significant limb down
+	template<typename T>
+	inline T BigInteger::toIntegral() const {
+		if (isSmall()) {
+			return (T)small;
+		}
+
+		T result = 0;
+		for (std::size_t i = magnitude.size(); i > 0; i--) {
+			result = (T)((result << 16) << 16) | (T)magnitude[i - 1];
+		}
+		return negative ? (T)-result : result;
+	}
+
+	// zero
+	inline BigInteger::BigInteger() : small(0), negative(false) {}
+
+	// return true if the value is stored inline
+	inline bool BigInteger::isSmall() const {
+		return magnitude.empty();
+	}
+
+	// sign of the value
+	inline int BigInteger::sign() const {
+		if (isSmall()) {
+			return (small > 0) - (small < 0);
+		}
+		return negative ? -1 : 1;
+	}
+
+	// negation -- only the minimum 64-bit value needs promotion
+	inline BigInteger BigInteger::operator-() const {
+		std::int64_t result;
+		if (isSmall() && !IntegerTraits<std::int64_t>::negateOverflow(small, result)) {
+			return BigInteger(result);
+		}
+		return addSlow(BigInteger(), *this, true);
+	}
+
+	// addition -- native add unless an operand is promoted or the sum overflows
+	inline BigInteger& BigInteger::operator+=(const BigInteger& other) {
+		std::int64_t result;
+		if (isSmall() && other.isSmall() && !IntegerTraits<std::int64_t>::addOverflow(small, other.small, result)) {
+			small = result;
+		}
+		else {
+			*this = addSlow(*this, other, false);
+		}
+		return *this;
+	}
+
+	// subtraction -- native subtract unless an operand is promoted or the difference overflows
+	inline BigInteger& BigInteger::operator-=(const BigInteger& other) {
+		std::int64_t result;
+		if (isSmall() && other.isSmall() && !IntegerTraits<std::int64_t>::subOverflow(small, other.small, result)) {
+			small = result;
+		}
+		else {
+			*this = addSlow(*this, other, true);
+		}
+		return *this;
+	}
+
+	// multiplication -- native multiply unless an operand is promoted or the product overflows
+	inline BigInteger& BigInteger::operator*=(const BigInteger& other) {
+		std::int64_t result;
+		if (isSmall() && other.isSmall() && !IntegerTraits<std::int64_t>::mulOverflow(small, other.small, result)) {
+			small = result;
+		}
+		else {
+			*this = multiplySlow(*this, other);
+		}
+		return *this;
+	}
+
+	// division -- native divide unless an operand is promoted (or min / -1, which overflows)
+	inline BigInteger& BigInteger::operator/=(const BigInteger& other) {
+		if (isSmall() && other.isSmall() && other.small != 0 && !(other.small == -1 && small == std::numeric_limits<std::int64_t>::min())) {
+			small /= other.small;
+		}
+		else {
+			BigInteger quotient;
+			divideSlow(*this, other, &quotient, nullptr);
+			*this = quotient;
+		}
+		return *this;
+	}
+
+	// remainder -- native remainder unless an operand is promoted
+	inline BigInteger& BigInteger::operator%=(const BigInteger& other) {
+		if (isSmall() && other.isSmall() && other.small != 0) {
+			// x % -1 is always 0, and avoids the min / -1 trap
+			small = (other.small == -1) ? 0 : small % other.small;
+		}
+		else {
+			BigInteger remainder;
+			divideSlow(*this, other, nullptr, &remainder);
+			*this = remainder;
+		}
+		return *this;
+	}
+
+	// three way comparison
+	inline int BigInteger::compare(const BigInteger& lhs, const BigInteger& rhs) {
+		if (lhs.isSmall() && rhs.isSmall()) {
+			return (lhs.small > rhs.small) - (lhs.small < rhs.small);
+		}
+		return compareSlow(lhs, rhs);
+	}
+
+	// integer traits for BigInteger -- the arithmetic promotes instead of overflowing, so the checked functions never fail
+	template<>
+	struct IntegerTraits<BigInteger> {
+		// arbitrary-precision integers have no fixed-width unsigned counterpart
+		static const bool is_native = false;
+
+		// absolute value of the integer
+		static BigInteger abs(const BigInteger& value) {
+			return (value.sign() < 0) ? -value : value;
+		}
+
+		// convert the integer to a double
+		static double toDouble(const BigInteger& value) {
+			return value.toDouble();
+		}
+
+		// write the integer to an output stream
+		static void write(std::ostream& os, const BigInteger& value) {
+			os << value;
+		}
+
+		// convert the integer to a std::string
+		static std::string toString(const BigInteger& value) {
+			return value.toString();
+		}
+
+		// write the decimal digits of the integer to [first, last), as std::to_chars does
+		static std::to_chars_result toChars(char* first, char* last, const BigInteger& value) {
+			std::string digits = value.toString();
+			if ((std::size_t)(last - first) < digits.size()) {
+				return std::to_chars_result{ last, std::errc::value_too_large };
+			}
+			return std::to_chars_result{ std::copy(digits.begin(), digits.end(), first), std::errc() };
+		}
+
+		// add two integers into result -- never overflows
+		static bool addOverflow(const BigInteger& a, const BigInteger& b, BigInteger& result) {
+			result = a + b;
+			return false;
+		}
+
+		// subtract two integers into result -- never overflows
+		static bool subOverflow(const BigInteger& a, const BigInteger& b, BigInteger& result) {
+			result = a - b;
+			return false;
+		}
+
+		// multiply two integers into result -- never overflows
+		static bool mulOverflow(const BigInteger& a, const BigInteger& b, BigInteger& result) {
+			result = a * b;
+			return false;
+		}
+
+		// negate an integer into result -- never overflows
+		static bool negateOverflow(const BigInteger& a, BigInteger& result) {
+			result = -a;
+			return false;
+		}
+
+		// compare the products a*b and c*d, returning a negative value, zero, or a positive value
+		static int compareProducts(const BigInteger& a, const BigInteger& b, const BigInteger& c, const BigInteger& d) {
+			return BigInteger::compare(a * b, c * d);
+		}
+	};
+}
+
+#endif
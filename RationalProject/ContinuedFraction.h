@@ -0,0 +1,118 @@
+/**
+* File: ContinuedFraction.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header steps through the continued fraction expansion of a rational, term by term, along with its convergents --
+* the successively closer fractions p/q that the expansion passes through. Every convergent is the closest fraction to
+* the value among those with a denominator no larger than its own, so iterating them is the cheapest way to trade
+* accuracy for small terms. Nothing is stored: each step is one step of Euclid's algorithm.
+* The first term is the floor of the value, so a negative value starts with a negative term and continues with positive ones.
+* Example: for 43/30 = [1; 2, 3, 4] the convergents are 1, 3/2, 10/7 and 43/30.
+*/
+
+#ifndef CONTINUED_FRACTION_H
+#define CONTINUED_FRACTION_H
+
+#include <cstddef>
+
+#include "Rational.h"
+#include "DivideByZeroException.h"
+#include "OverflowException.h"
+
+namespace rational {
+	// iterates the terms and convergents of the continued fraction of a rational
+	template<typename IntT, typename GcdPolicy = BinaryGcd>
+	class BasicConvergents {
+	public:
+		// the rational type the convergents are returned as
+		typedef BasicRational<IntT, GcdPolicy> rational_type;
+
+		// start before the first term -- throws DivideByZeroException for a zero denominator
+		explicit BasicConvergents(const rational_type& value);
+
+		// advance to the next term and convergent, returning false once the expansion is exhausted
+		// throws OverflowException if the convergent does not fit in IntT (only possible near the limits of the type)
+		bool next();
+
+		// the current term -- valid once next has returned true
+		IntT term() const;
+		// the current convergent -- valid once next has returned true. The last one is the value itself
+		rational_type convergent() const;
+		// the number of terms read so far
+		std::size_t index() const;
+
+	private:
+		// the traits of the integer type
+		typedef typename rational_type::fraction_type::traits_type traits_type;
+
+		// the remainders of Euclid's algorithm
+		IntT remainderN;
+		IntT remainderD;
+		// the current convergent p1/q1, and the previous one p0/q0
+		IntT p0, q0, p1, q1;
+		// the current term
+		IntT currentTerm;
+		// the number of terms read
+		std::size_t count;
+	};
+
+	// iterates the convergents of a Rational
+	typedef BasicConvergents<int> Convergents;
+	// iterates the convergents of a Rational64
+	typedef BasicConvergents<std::int64_t> Convergents64;
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicConvergents<IntT, GcdPolicy>::BasicConvergents(const rational_type& value)
+		: remainderN(value.getNumerator()), remainderD(value.getDenominator()), p0(0), q0(1), p1(1), q1(0), currentTerm(0), count(0) {
+		if (remainderD == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicConvergents<IntT, GcdPolicy>::next() {
+		if (remainderD == 0) {
+			return false;
+		}
+
+		// the remainders advance only once the convergent is known to fit
+		IntT nextN = remainderN;
+		IntT nextD = remainderD;
+		const IntT a = continuedFractionStep(nextN, nextD);
+
+		// the convergents satisfy p2 = a * p1 + p0 and q2 = a * q1 + q0
+		IntT p2, q2;
+		if (traits_type::mulOverflow(a, p1, p2) || traits_type::addOverflow(p2, p0, p2)
+			|| traits_type::mulOverflow(a, q1, q2) || traits_type::addOverflow(q2, q0, q2)) {
+			throw exception::OverflowException(__FILE__, __LINE__);
+		}
+		p0 = p1;
+		q0 = q1;
+		p1 = p2;
+		q1 = q2;
+
+		currentTerm = a;
+		remainderN = nextN;
+		remainderD = nextD;
+		count++;
+		return true;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline IntT BasicConvergents<IntT, GcdPolicy>::term() const {
+		return currentTerm;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline typename BasicConvergents<IntT, GcdPolicy>::rational_type BasicConvergents<IntT, GcdPolicy>::convergent() const {
+		return rational_type(p1, q1);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline std::size_t BasicConvergents<IntT, GcdPolicy>::index() const {
+		return count;
+	}
+}
+
+#endif
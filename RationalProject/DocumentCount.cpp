@@ -10,23 +10,15 @@
 
 // constructor
 DocumentCount::DocumentCount(const std::vector<std::string>& document) : totalCharacters(0) {
-	// initialize collection
-	characterCountArray = new RationalArray(6);
 	// add rational objects to the array
-	for (unsigned int i = 0; i < characterCountArray->capacity(); i++) {
-		characterCountArray->add(Rational(0));
+	for (unsigned int i = 0; i < characterCountArray.capacity(); i++) {
+		characterCountArray.add(Rational(0));
 	}
 	
 	// populate data
 	fillArray(document);
 }
 
-// destructor
-DocumentCount::~DocumentCount() {
-	// delete the object
-	delete characterCountArray;
-}
-
 // return true if the sum of the lowercase and uppercase equals the alphabetic count, throw CountsNotEqualException otherwise
 bool DocumentCount::isUpperLowerEqualToAlpha() const {
 	// get rational counts
@@ -116,55 +108,55 @@ DocumentCount::CharType DocumentCount::getType(const char c) const {
 
 // add one to the alpahbetic count
 void DocumentCount::addToAlphabetic() {
-	characterCountArray->replace(ALPHABETIC, getAlpha() + 1);
+	characterCountArray.replace(ALPHABETIC, getAlpha() + 1);
 }
 // add one to the decimal count
 void DocumentCount::addToDecimal() {
-	characterCountArray->replace(DECIMAL, getDecimal() + 1);
+	characterCountArray.replace(DECIMAL, getDecimal() + 1);
 }
 // add one to the punctuation count
 void DocumentCount::addToPunctuation() {
-	characterCountArray->replace(PUNCTUATION, getPunctuation() + 1);
+	characterCountArray.replace(PUNCTUATION, getPunctuation() + 1);
 }
 
 // add one to the lowercase count
 void DocumentCount::addToLowercase() {
-	characterCountArray->replace(LOWERCASE, getLowercase() + 1);
+	characterCountArray.replace(LOWERCASE, getLowercase() + 1);
 }
 
 // add one to the uppercase count
 void DocumentCount::addToUppercase() {
-	characterCountArray->replace(UPPERCASE, getUppercase() + 1);
+	characterCountArray.replace(UPPERCASE, getUppercase() + 1);
 }
 
 // add one to the other count
 void DocumentCount::addToOther() {
-	characterCountArray->replace(OTHER, getOther() + 1);
+	characterCountArray.replace(OTHER, getOther() + 1);
 }
 
 // get the alpha character count
 Rational DocumentCount::getAlpha() const {
-	return characterCountArray->retrieve(ALPHABETIC);
+	return characterCountArray.retrieve(ALPHABETIC);
 }
 // get the lowercase character count
 Rational DocumentCount::getLowercase() const {
-	return characterCountArray->retrieve(LOWERCASE);
+	return characterCountArray.retrieve(LOWERCASE);
 }
 // get the uppercase character count
 Rational DocumentCount::getUppercase() const {
-	return characterCountArray->retrieve(UPPERCASE);
+	return characterCountArray.retrieve(UPPERCASE);
 }
 // get the decimal character count
 Rational DocumentCount::getDecimal() const {
-	return characterCountArray->retrieve(DECIMAL);
+	return characterCountArray.retrieve(DECIMAL);
 }
 // get the punctuation character count
 Rational DocumentCount::getPunctuation() const {
-	return characterCountArray->retrieve(PUNCTUATION);
+	return characterCountArray.retrieve(PUNCTUATION);
 }
 // get the other character count
 Rational DocumentCount::getOther() const {
-	return characterCountArray->retrieve(OTHER);
+	return characterCountArray.retrieve(OTHER);
 }
 
 // print the counts in the collection
@@ -11,6 +11,7 @@
 
 #include "Rational.h"
 #include "RationalArray.h"
+#include "RationalSmallArray.h"
 #include <stdexcept>
 #include <vector>
 #include <string>
@@ -22,8 +23,6 @@ class DocumentCount {
 public:
 	// constructor, initialized from a vector of strings
 	explicit DocumentCount(const std::vector<std::string>& document);
-	// destructor
-	~DocumentCount();
 
 	// return true if the sum of lowercase and uppercase characters is equal to the total of alphabetic characters
 	// throws CountsNotEqualException if not
@@ -48,7 +47,8 @@ public:
 	Rational getOther() const;
 private:
 	int totalCharacters;
-	RationalArray* characterCountArray;
+	// one count per character type, stored inline
+	RationalSmallArray<6> characterCountArray;
 
 	// enum definition for indices
 	enum CharType {
@@ -10,11 +10,9 @@
 
 // constructor
 DocumentRatio::DocumentRatio(const DocumentCount& docCount) : totalCharacters(docCount.getTotalChars()) {
-	// construct an array with initial capacity
-	characterRatioArray = new RationalArray(8);
 	// create Rational objects
-	for (unsigned int i = 0; i < characterRatioArray->capacity(); i++) {
-		characterRatioArray->add(Rational(0));
+	for (unsigned int i = 0; i < characterRatioArray.capacity(); i++) {
+		characterRatioArray.add(Rational(0));
 	}
 	
 	// if there are some characters, fill the array
@@ -23,12 +21,6 @@ DocumentRatio::DocumentRatio(const DocumentCount& docCount) : totalCharacters(do
 	}
 }
 
-// Destructor
-DocumentRatio::~DocumentRatio() {
-	// delete the object
-	delete characterRatioArray;
-}
-
 // are these ratios one to one? true if so, exception if not
 // sum of alpha, decimal, punctuation, and other = 1
 bool DocumentRatio::isOneToOne() const {
@@ -52,19 +44,19 @@ bool DocumentRatio::isOneToOne() const {
 // initialize the container
 void DocumentRatio::fillArray(const DocumentCount& docCount) {
 	// use the document counts to initialize the ratios
-	characterRatioArray->replace(ALPHABETIC, Rational(docCount.getAlpha().getNumerator(), totalCharacters));
-	characterRatioArray->replace(UPPERCASE, Rational(docCount.getUppercase().getNumerator(), totalCharacters));
-	characterRatioArray->replace(LOWERCASE, Rational(docCount.getLowercase().getNumerator(), totalCharacters));
-	characterRatioArray->replace(DECIMAL, Rational(docCount.getDecimal().getNumerator(), totalCharacters));
-	characterRatioArray->replace(PUNCTUATION, Rational(docCount.getPunctuation().getNumerator(), totalCharacters));
-	characterRatioArray->replace(OTHER, Rational(docCount.getOther().getNumerator(), totalCharacters));
+	characterRatioArray.replace(ALPHABETIC, Rational(docCount.getAlpha().getNumerator(), totalCharacters));
+	characterRatioArray.replace(UPPERCASE, Rational(docCount.getUppercase().getNumerator(), totalCharacters));
+	characterRatioArray.replace(LOWERCASE, Rational(docCount.getLowercase().getNumerator(), totalCharacters));
+	characterRatioArray.replace(DECIMAL, Rational(docCount.getDecimal().getNumerator(), totalCharacters));
+	characterRatioArray.replace(PUNCTUATION, Rational(docCount.getPunctuation().getNumerator(), totalCharacters));
+	characterRatioArray.replace(OTHER, Rational(docCount.getOther().getNumerator(), totalCharacters));
 
 	// special ratios that could throw a DBZ exception
 	if (docCount.getLowercase() != 0) {
-		characterRatioArray->replace(UPPER_TO_LOWER, docCount.getUppercase() / docCount.getLowercase());
+		characterRatioArray.replace(UPPER_TO_LOWER, docCount.getUppercase() / docCount.getLowercase());
 	}
 	if (docCount.getPunctuation() != 0) {
-		characterRatioArray->replace(UPPER_TO_PUNCTUATION, docCount.getUppercase() / docCount.getPunctuation());
+		characterRatioArray.replace(UPPER_TO_PUNCTUATION, docCount.getUppercase() / docCount.getPunctuation());
 	}
 }
 
@@ -83,35 +75,40 @@ void DocumentRatio::printRatios() const {
 
 // get the alpha to total character ratio
 Rational DocumentRatio::getAlpha() const {
-	return characterRatioArray->retrieve(ALPHABETIC);
+	return characterRatioArray.retrieve(ALPHABETIC);
 }
 // get the lowercase to total character ratio
 Rational DocumentRatio::getLowercase() const {
-	return characterRatioArray->retrieve(LOWERCASE);
+	return characterRatioArray.retrieve(LOWERCASE);
 }
 // get the uppercase to total character ratio
 Rational DocumentRatio::getUppercase() const {
-	return characterRatioArray->retrieve(UPPERCASE);
+	return characterRatioArray.retrieve(UPPERCASE);
 }
 // get the decimal to total character ratio
 Rational DocumentRatio::getDecimal() const {
-	return characterRatioArray->retrieve(DECIMAL);
+	return characterRatioArray.retrieve(DECIMAL);
 }
 // get the punctuation to total character ratio
 Rational DocumentRatio::getPunctuation() const {
-	return characterRatioArray->retrieve(PUNCTUATION);
+	return characterRatioArray.retrieve(PUNCTUATION);
 }
 // get the other to total character ratio
 Rational DocumentRatio::getOther() const {
-	return characterRatioArray->retrieve(OTHER);
+	return characterRatioArray.retrieve(OTHER);
 }
 // get the uppercase to lowercase character ratio
 Rational DocumentRatio::getUpperToLower() const {
-	return characterRatioArray->retrieve(UPPER_TO_LOWER);
+	return characterRatioArray.retrieve(UPPER_TO_LOWER);
 }
 // get the uppercase to punctuation character ratio
 Rational DocumentRatio::getUpperToPunctuation() const {
-	return characterRatioArray->retrieve(UPPER_TO_PUNCTUATION);
+	return characterRatioArray.retrieve(UPPER_TO_PUNCTUATION);
+}
+
+// get the character ratios collection
+const RationalArray& DocumentRatio::getCharacterRatios() const {
+	return characterRatioArray;
 }
 
 /*
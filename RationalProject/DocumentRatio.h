@@ -11,6 +11,7 @@
 
 #include "Rational.h"
 #include "RationalArray.h"
+#include "RationalSmallArray.h"
 #include "DocumentCount.h"
 
 using namespace rational;
@@ -20,8 +21,6 @@ class DocumentRatio {
 public:
 	// constructor, initialized from a vector of strings
 	explicit DocumentRatio(const DocumentCount& docCount);
-	// destructor
-	~DocumentRatio();
 
 	// return true if the sum of the ratios of alphabetic, decimal, punctuation, and other characters to total is 1:1
 	// throws RatiosNotEqualException if not
@@ -48,10 +47,11 @@ public:
 	Rational getUpperToPunctuation() const;
 
 	// get the character ratios collection
-	RationalArray& getCharacterRatios() const;
+	const RationalArray& getCharacterRatios() const;
 private:
 	int totalCharacters;
-	RationalArray* characterRatioArray;
+	// one ratio per ratio type, stored inline
+	RationalSmallArray<8> characterRatioArray;
 
 	// enum definition for indices
 	enum RatioType {
@@ -3,8 +3,10 @@
 * Author: Ryan Johnson
 * Email: johnsonrw82@csu.fullerton.edu
 *
-* Header definition for class Fraction
+* Header definition for class template BasicFraction, and the Fraction type (a BasicFraction of int)
 * Additional capability such as lowest terms reduction on an object and some static functions has been added
+* The class is header-only so the arithmetic can be inlined into the caller
+* All arithmetic is overflow-checked: an OverflowException is thrown instead of silently wrapping
 */
 
 #ifndef FRACTION_H
@@ -14,13 +16,17 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <algorithm>
 
+#include "IntegerTraits.h"
+#include "Gcd.h"
 #include "InvalidFormatException.h"
 #include "InvalidArgumentException.h"
 #include "DivideByZeroException.h"
+#include "OverflowException.h"
 
 /*
-* class definition for Fraction
+* class definition for BasicFraction
 *
 * Fractions can be initialized in 3 ways:
 *   Default - no args				Fraction()
@@ -31,40 +37,55 @@
 *   Another Fraction	Fraction f2 = f1;
 * Fractions can be retreived as a double (num / denom)
 * Fractions can be printed to the screen in lowest terms
+*
+* The numerator and denominator are stored as IntT (int, std::int64_t or __int128)
+* GcdPolicy selects the algorithm used to reduce to lowest terms (rational::BinaryGcd or rational::EuclidGcd)
 */
-class Fraction {
-public:	
+template<typename IntT, typename GcdPolicy = rational::BinaryGcd>
+class BasicFraction {
+public:
+	// the integer type of the numerator and denominator
+	typedef IntT value_type;
+	// the traits for the integer type
+	typedef rational::IntegerTraits<IntT> traits_type;
+	// the algorithm used to reduce to lowest terms
+	typedef GcdPolicy gcd_policy;
+
 	// default constructor
-	Fraction();
+	BasicFraction();
 	// numerator/denominator constructor
-	Fraction(const int numerator, const int denominator = 1);
-	// copy constructor
-	Fraction(const Fraction& fraction);
+	BasicFraction(const IntT numerator, const IntT denominator = 1);
+	// copy/move constructors -- the sign of the denominator is already normalized, so these are plain copies
+	BasicFraction(const BasicFraction& fraction) = default;
+	BasicFraction(BasicFraction&& fraction) = default;
 
 	// set numerator
-	void setNumerator(const int numerator);
+	void setNumerator(const IntT numerator);
 	// set denominator
-	void setDenominator(const int denominator);
+	void setDenominator(const IntT denominator);
 	// get numerator
-	int getNumerator() const;
+	IntT getNumerator() const;
 	// get denominator
-	int getDenominator() const;
+	IntT getDenominator() const;
 
 	// operator overloads - arithmetic operators
-	Fraction operator+(const Fraction& fraction);
-	Fraction operator-(const Fraction& fraction);
-	Fraction operator*(const Fraction& fraction);
-	Fraction operator/(const Fraction& fraction);
+	BasicFraction operator+(const BasicFraction& fraction) const;
+	BasicFraction operator-(const BasicFraction& fraction) const;
+	BasicFraction operator*(const BasicFraction& fraction) const;
+	BasicFraction operator/(const BasicFraction& fraction) const;
 
 	// assignment operators
-	Fraction& operator=(const int integerValue);
-	Fraction& operator=(Fraction fraction);
+	BasicFraction& operator=(const IntT integerValue);
+	BasicFraction& operator=(const BasicFraction& fraction) = default;
+	BasicFraction& operator=(BasicFraction&& fraction) = default;
 	// overload for <<, declared as friend
-	friend std::ostream& operator<<(std::ostream& os, const Fraction& fraction);
+	friend std::ostream& operator<<(std::ostream& os, const BasicFraction& fraction) {
+		return fraction.writeFraction(os);
+	}
 
 	// equality operators
-	bool operator==(const Fraction& fraction) const;
-	bool operator!=(const Fraction& fraction) const;
+	bool operator==(const BasicFraction& fraction) const;
+	bool operator!=(const BasicFraction& fraction) const;
 
 	// get double representation
 	double toDouble() const;
@@ -72,36 +93,375 @@ public:
 	void printFractionInLowestTerms();
 	// function that will modify the fraction to remain in lowest terms
 	// this is a static function that operates on a reference
-	static void toLowestTerms(Fraction& fractionObj);
+	static void toLowestTerms(BasicFraction& fractionObj);
 	// this function will modify each fraction argument such that the denominators are common
-	static void toCommonDenominator(Fraction& fraction1, Fraction& fraction2);
+	static void toCommonDenominator(BasicFraction& fraction1, BasicFraction& fraction2);
 
 	// inverse of fraction
-	Fraction inv() const; 
+	BasicFraction inv() const;
+
+protected:
+	// overflow-checked arithmetic -- these throw an OverflowException if the result does not fit in IntT
+	static IntT checkedAdd(const IntT a, const IntT b);
+	static IntT checkedSubtract(const IntT a, const IntT b);
+	static IntT checkedMultiply(const IntT a, const IntT b);
+	static IntT checkedNegate(const IntT a);
+	static IntT checkedAbs(const IntT a);
 
 private:
-	int numerator;
-	int denominator;
+	IntT numerator;
+	IntT denominator;
 
 
 	// get the gcd of the numerator/denominator
-	static int getGcd(const int dividend, const int remainder );
+	static IntT getGcd(const IntT num1, const IntT num2);
 	// get least common multiple of two numbers
-	static int getLcm(const int num1, const int num2);
+	static IntT getLcm(const IntT num1, const IntT num2);
 	// get fraction in lowest terms
 	std::string toLowestTermsString();
+	// stream the fraction (used by operator<<)
+	std::ostream& writeFraction(std::ostream& os) const;
 };
 
+// the fraction type used throughout the project
+typedef BasicFraction<int> Fraction;
+
 // this function is a helper function that will convert a number to a std::string
 // this function is needed because some compilers in the Cygwin/MinGW toolset have
 // a bug that results in std::to_string producing an error that says:
 // "to_string is not a member of std", even when using the C++11 standard
 template<typename T>
 inline std::string numToString(T num) {
-	std::ostringstream ss;
-	ss << num;
-	return ss.str();
+	return rational::IntegerTraits<T>::toString(num);
+}
+
+// default constructor
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy>::BasicFraction() : numerator(0), denominator(1) {}
+
+// integer constructor
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy>::BasicFraction(const IntT numerator, const IntT denominator) : numerator((denominator < 0) ? checkedNegate(numerator) : numerator), denominator(checkedAbs(denominator)) {}
+
+// set numerator
+template<typename IntT, typename GcdPolicy>
+inline void BasicFraction<IntT, GcdPolicy>::setNumerator(const IntT numerator) {
+	this->numerator = numerator;
+}
+
+// set denominator
+template<typename IntT, typename GcdPolicy>
+inline void BasicFraction<IntT, GcdPolicy>::setDenominator(const IntT denominator) {
+	// if the denominator is negative, multiply the numerator by -1
+	if (denominator < 0) {
+		setNumerator(checkedNegate(getNumerator()));
+	}
+	this->denominator = checkedAbs(denominator);
+}
+
+// get numerator
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::getNumerator() const {
+	return numerator;
+}
+
+// get denominator
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::getDenominator() const {
+	return denominator;
+}
+
+// operator overloads
+// overloaded equals operator that sets the fraction to a given integer value
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy>& BasicFraction<IntT, GcdPolicy>::operator=(const IntT integerValue) {
+	// copy and swap
+	BasicFraction tmp(integerValue, 1);
+
+	std::swap(numerator, tmp.numerator);
+	std::swap(denominator, tmp.denominator);
+
+	return *this;
+}
+
+// addition of another fraction
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy> BasicFraction<IntT, GcdPolicy>::operator+(const BasicFraction& fraction) const {
+	BasicFraction fraction1(*this);
+	BasicFraction fraction2(fraction);
+
+	// convert fractions to common denominators
+	toCommonDenominator(fraction1, fraction2);
+
+	// add them together (by adding the numerators)
+	fraction1.setNumerator(checkedAdd(fraction1.getNumerator(), fraction2.getNumerator()));
+
+	return fraction1;
+}
+
+// subtraction of another fraction
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy> BasicFraction<IntT, GcdPolicy>::operator-(const BasicFraction& fraction) const {
+	BasicFraction tmp(fraction);
+	tmp = tmp * -1;
+
+	return *this + tmp;
+}
+
+// multiplication by another fraction
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy> BasicFraction<IntT, GcdPolicy>::operator*(const BasicFraction& fraction) const {
+	BasicFraction tmp(*this);
+
+	tmp.setNumerator(checkedMultiply(tmp.getNumerator(), fraction.getNumerator()));
+
+	// divide by zero (masked in a multiply)
+	if (tmp.getDenominator() == 0 || fraction.getDenominator() == 0) {
+		throw rational::exception::DivideByZeroException(__FILE__, __LINE__);
+	}
+	tmp.setDenominator(checkedMultiply(tmp.getDenominator(), fraction.getDenominator()));
+
+	return tmp;
+}
+
+// division by another fraction
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy> BasicFraction<IntT, GcdPolicy>::operator/(const BasicFraction& fraction) const {
+	BasicFraction tmp(fraction);
+
+	// divide by zero -- if argument fraction is zero, then it's a DBZ
+	if (fraction.getNumerator() == 0) {
+		throw rational::exception::DivideByZeroException(__FILE__, __LINE__);
+	}
+
+	// invert the fraction - dividing a fraction by a fraction is multiplying by the inverse
+	tmp = tmp.inv();
+
+	return *this * tmp;
+}
+
+// equality operators
+// return true if these Fractions are equal
+template<typename IntT, typename GcdPolicy>
+inline bool BasicFraction<IntT, GcdPolicy>::operator==(const BasicFraction& fraction) const {
+	return getNumerator() == fraction.getNumerator() && getDenominator() == fraction.getDenominator();
+}
+
+// return true if these fractions are not equal
+template<typename IntT, typename GcdPolicy>
+inline bool BasicFraction<IntT, GcdPolicy>::operator!=(const BasicFraction& fraction) const {
+	return !(*this == fraction);
+}
+
+// write the fraction to the stream -- implementation of the << operator
+template<typename IntT, typename GcdPolicy>
+inline std::ostream& BasicFraction<IntT, GcdPolicy>::writeFraction(std::ostream& os) const {
+	if (getNumerator() == 0) {
+		return os << 0;
+	}
+	else if (getDenominator() == 1) {
+		traits_type::write(os, getNumerator());
+		return os;
+	}
+	else if (getDenominator() == 0) {
+		os << "Fraction ";
+		traits_type::write(os, getNumerator());
+		os << "/";
+		traits_type::write(os, getDenominator());
+		return os << " is invalid";
+	}
+
+	traits_type::write(os, getNumerator());
+	os << "/";
+	traits_type::write(os, getDenominator());
+	return os;
 }
 
+// print the fraction in lowest terms;
+template<typename IntT, typename GcdPolicy>
+inline void BasicFraction<IntT, GcdPolicy>::printFractionInLowestTerms() {
+	// print the fraction in lowest terms
+	std::cout << toLowestTermsString().c_str();
+}
+
+// output the value of the fraction as a double
+template<typename IntT, typename GcdPolicy>
+inline double BasicFraction<IntT, GcdPolicy>::toDouble() const {
+	// return 0 when denominator is 0
+	if (getDenominator() == 0) {
+		throw rational::exception::DivideByZeroException(__FILE__, __LINE__);
+	}
+
+	return traits_type::toDouble(getNumerator()) / traits_type::toDouble(getDenominator());
+}
+
+// return the inverse of this fraction
+template<typename IntT, typename GcdPolicy>
+inline BasicFraction<IntT, GcdPolicy> BasicFraction<IntT, GcdPolicy>::inv() const {
+	if (getNumerator() == 0) {
+		return BasicFraction(0);
+	}
+	return BasicFraction(getDenominator(), getNumerator());
+}
+
+// add two integers, throwing an OverflowException if the sum does not fit
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::checkedAdd(const IntT a, const IntT b) {
+	IntT result;
+	if (traits_type::addOverflow(a, b, result)) {
+		throw rational::exception::OverflowException(__FILE__, __LINE__);
+	}
+	return result;
+}
+
+// subtract two integers, throwing an OverflowException if the difference does not fit
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::checkedSubtract(const IntT a, const IntT b) {
+	IntT result;
+	if (traits_type::subOverflow(a, b, result)) {
+		throw rational::exception::OverflowException(__FILE__, __LINE__);
+	}
+	return result;
+}
+
+// multiply two integers, throwing an OverflowException if the product does not fit
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::checkedMultiply(const IntT a, const IntT b) {
+	IntT result;
+	if (traits_type::mulOverflow(a, b, result)) {
+		throw rational::exception::OverflowException(__FILE__, __LINE__);
+	}
+	return result;
+}
+
+// negate an integer, throwing an OverflowException for the minimum value
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::checkedNegate(const IntT a) {
+	IntT result;
+	if (traits_type::negateOverflow(a, result)) {
+		throw rational::exception::OverflowException(__FILE__, __LINE__);
+	}
+	return result;
+}
+
+// absolute value of an integer, throwing an OverflowException for the minimum value
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::checkedAbs(const IntT a) {
+	return (a < 0) ? checkedNegate(a) : a;
+}
+
+// private function to find the (non-negative) GCD of two numbers, using the GCD policy
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::getGcd(const IntT num1, const IntT num2) {
+	return GcdPolicy::gcd(num1, num2);
+}
+
+// get the LCM (least common multiple of two numbers
+template<typename IntT, typename GcdPolicy>
+inline IntT BasicFraction<IntT, GcdPolicy>::getLcm(const IntT num1, const IntT num2) {
+
+	// prevent divide by zero
+	if (num1 == 0 || num2 == 0) {
+		throw rational::exception::DivideByZeroException(__FILE__, __LINE__);
+	}
+
+	// find the GCD
+	IntT gcd = getGcd(num1, num2);
+
+	// divide by zero exception
+	if (gcd == 0) {
+		throw rational::exception::DivideByZeroException(__FILE__, __LINE__);
+	}
+
+	// the LCM is the product of the two numbers, divided by GCD
+	IntT lcm = checkedMultiply(num1 / gcd, num2);
+
+	return lcm;
+}
+
+// private function returning a string representation of the fraction in lowest terms
+// this does not modify the fraction to be in lowest terms, only returns the string representing it
+template<typename IntT, typename GcdPolicy>
+inline std::string BasicFraction<IntT, GcdPolicy>::toLowestTermsString() {
+	std::string result;
+
+	// invalid fraction
+	if (getDenominator() == 0) {
+		result = "Fraction " + numToString(getNumerator());
+		result += "/" + numToString(getDenominator());
+		result += " is invalid.";
+	}
+
+	// this will be true for 0 fractions
+	else if (getNumerator() == 0) {
+		result = numToString(getNumerator());
+	}
+	// else - perform the math
+	else {
+		// find the GCD
+		IntT gcd = getGcd(getNumerator(), getDenominator());
+
+		// divide each term by the gcd
+		IntT newNumerator = numerator / gcd;
+		IntT newDenominator = getDenominator() / gcd;
+
+		newNumerator = (newDenominator < 0) ? -newNumerator : newNumerator;
+		newDenominator = traits_type::abs(newDenominator);
+
+		// denominator of 1 is just the numerator
+		if (newDenominator == 1) {
+			result = numToString(newNumerator);
+		}
+		// valid fraction
+		else {
+			result = numToString(newNumerator) + "/";
+			result += numToString(newDenominator);
+		}
+	}
+
+	return result;
+}
+
+// this function will reduce the fraction to lowest terms, and will keep it that way
+template<typename IntT, typename GcdPolicy>
+inline void BasicFraction<IntT, GcdPolicy>::toLowestTerms(BasicFraction& fractionObj) {
+	if (fractionObj.getNumerator() == 0) {
+		fractionObj.setDenominator(1); // set to 1, since it's a zero fraction
+	}
+	else if (fractionObj.getDenominator() != 0) {
+		// find the GCD
+		IntT gcd = getGcd(fractionObj.getNumerator(), fractionObj.getDenominator());
+
+		// divide each term by the gcd
+		IntT newNumerator = fractionObj.getNumerator() / gcd;
+		IntT newDenominator = fractionObj.getDenominator() / gcd;
+
+		newNumerator = (newDenominator < 0) ? -newNumerator : newNumerator;
+		newDenominator = traits_type::abs(newDenominator);
+
+		// set the numerator and denominator
+		fractionObj.setNumerator(newNumerator);
+		fractionObj.setDenominator(newDenominator);
+	}
+	else {
+		throw rational::exception::DivideByZeroException(__FILE__, __LINE__);
+	}
+}
+
+// function that will modify the fraction references to have common denominators (supports things like add/sub and comparison)
+template<typename IntT, typename GcdPolicy>
+inline void BasicFraction<IntT, GcdPolicy>::toCommonDenominator(BasicFraction& fraction1, BasicFraction& fraction2) {
+	// get the lcm of the denominators
+	// no divide by zero can happen below since getLcm() will throw it if possible
+	IntT lcm = getLcm(fraction1.getDenominator(), fraction2.getDenominator());
+
+	// use the LCM to determine how much to multiply each fraction by in order to get the denominators equal to the LCM
+	IntT mult1 = lcm / fraction1.getDenominator();
+	IntT mult2 = lcm / fraction2.getDenominator();
+
+	// multiply each fraction by the amount needed to make the denominators equal to LCM
+	fraction1 = fraction1 * BasicFraction(mult1, mult1);
+	fraction2 = fraction2 * BasicFraction(mult2, mult2);
+}
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,148 @@
+/**
+* File: Gcd.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header provides the GCD policies used by the Fraction and Rational class templates to reduce to lowest terms.
+* BinaryGcd (the default) is an iterative binary (Stein) GCD built on count-trailing-zeros; EuclidGcd is the
+* iterative modulo-based algorithm. Both return the non-negative GCD of the magnitudes of their arguments.
+* Define RATIONAL_NO_CTZ to use the portable (de Bruijn) count-trailing-zeros on platforms without an intrinsic.
+*/
+
+#ifndef GCD_H
+#define GCD_H
+
+#include <cstdint>
+#include <type_traits>
+
+#include "IntegerTraits.h"
+
+#if defined(_MSC_VER) && !defined(RATIONAL_NO_CTZ)
+#include <intrin.h>
+#endif
+
+namespace rational {
+	// count the trailing zero bits of a non-zero value without an intrinsic
+	// the lowest set bit is isolated and multiplied by a de Bruijn sequence, whose top bits index a lookup table
+	template<typename UIntT>
+	inline int countTrailingZerosPortable(const UIntT value) {
+		if constexpr (sizeof(UIntT) <= sizeof(std::uint32_t)) {
+			static const int table[32] = {
+				0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+				31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+			};
+			std::uint32_t bits = (std::uint32_t)value;
+			return table[(std::uint32_t)((bits & (0 - bits)) * 0x077CB531u) >> 27];
+		}
+		else if constexpr (sizeof(UIntT) <= sizeof(std::uint64_t)) {
+			static const int table[64] = {
+				0, 1, 2, 53, 3, 7, 54, 27, 4, 38, 41, 8, 34, 55, 48, 28,
+				62, 5, 39, 46, 44, 42, 22, 9, 24, 35, 59, 56, 49, 18, 29, 11,
+				63, 52, 6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+				51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+			};
+			std::uint64_t bits = (std::uint64_t)value;
+			return table[((bits & (0 - bits)) * 0x022FDD63CC95386DULL) >> 58];
+		}
+		else {
+			// wider values -- scan the low half, then the high half
+			std::uint64_t low = (std::uint64_t)value;
+			return (low != 0) ? countTrailingZerosPortable(low) : 64 + countTrailingZerosPortable((std::uint64_t)(value >> 64));
+		}
+	}
+
+	// count the trailing zero bits of a non-zero unsigned value
+	template<typename UIntT>
+	inline int countTrailingZeros(const UIntT value) {
+#if defined(RATIONAL_NO_CTZ)
+		return countTrailingZerosPortable(value);
+#elif defined(__GNUC__) || defined(__clang__)
+		if constexpr (sizeof(UIntT) <= sizeof(unsigned int)) {
+			return __builtin_ctz((unsigned int)value);
+		}
+		else if constexpr (sizeof(UIntT) <= sizeof(unsigned long long)) {
+			return __builtin_ctzll((unsigned long long)value);
+		}
+		else {
+			// 128-bit values -- scan the low half, then the high half
+			unsigned long long low = (unsigned long long)value;
+			return (low != 0) ? __builtin_ctzll(low) : 64 + __builtin_ctzll((unsigned long long)(value >> 64));
+		}
+#elif defined(_MSC_VER)
+		unsigned long index;
+		if constexpr (sizeof(UIntT) <= sizeof(unsigned long)) {
+			_BitScanForward(&index, (unsigned long)value);
+		}
+		else {
+#if defined(_M_X64) || defined(_M_ARM64)
+			_BitScanForward64(&index, (unsigned __int64)value);
+#else
+			// 32-bit targets have no 64-bit scan -- scan the low half, then the high half
+			if (!_BitScanForward(&index, (unsigned long)value)) {
+				_BitScanForward(&index, (unsigned long)(value >> 32));
+				index += 32;
+			}
+#endif
+		}
+		return (int)index;
+#else
+		return countTrailingZerosPortable(value);
+#endif
+	}
+
+	// iterative modulo-based (Euclid) GCD
+	struct EuclidGcd {
+		template<typename IntT>
+		static IntT gcd(const IntT a, const IntT b) {
+			IntT x = IntegerTraits<IntT>::abs(a);
+			IntT y = IntegerTraits<IntT>::abs(b);
+			while (y != 0) {
+				IntT remainder = x % y;
+				x = y;
+				y = remainder;
+			}
+			return x;
+		}
+	};
+
+	// iterative binary (Stein) GCD -- integers without a native representation fall back to Euclid
+	struct BinaryGcd {
+		template<typename IntT>
+		static IntT gcd(const IntT a, const IntT b) {
+			if constexpr (IntegerTraits<IntT>::is_native) {
+				typedef typename IntegerTraits<IntT>::unsigned_type UIntT;
+				// work with unsigned magnitudes, so the minimum value does not overflow
+				return (IntT)gcdUnsigned<UIntT>((a < 0) ? UIntT(0) - UIntT(a) : UIntT(a), (b < 0) ? UIntT(0) - UIntT(b) : UIntT(b));
+			}
+			else {
+				return EuclidGcd::gcd(a, b);
+			}
+		}
+
+		// binary GCD of two unsigned values
+		template<typename UIntT>
+		static UIntT gcdUnsigned(UIntT u, UIntT v) {
+			if (u == 0) {
+				return v;
+			}
+			if (v == 0) {
+				return u;
+			}
+
+			// the common power of two is restored at the end
+			const int shift = countTrailingZeros<UIntT>(u | v);
+			u >>= countTrailingZeros<UIntT>(u);
+			do {
+				// both are odd here, so their difference is even -- strip its factors of two
+				v >>= countTrailingZeros<UIntT>(v);
+				UIntT smaller = (u < v) ? u : v;
+				v = ((u < v) ? v : u) - smaller;
+				u = smaller;
+			} while (v != 0);
+
+			return u << shift;
+		}
+	};
+}
+
+#endif
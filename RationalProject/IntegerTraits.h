@@ -0,0 +1,268 @@
+/**
+* File: IntegerTraits.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header provides the integer traits used by the Fraction and Rational class templates.
+* The traits collect the handful of operations that are not available for every integer type (such as
+* std::abs or stream output for 128-bit integers), so the templates can be instantiated with any of them.
+* The checked arithmetic functions report overflow instead of silently wrapping. They use the compiler's
+* checked-arithmetic builtins where available, and a portable range check otherwise.
+* compareProducts compares two products exactly, for cross-multiplied comparison of fractions.
+*/
+
+#ifndef INTEGER_TRAITS_H
+#define INTEGER_TRAITS_H
+
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cstdint>
+#include <limits>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace rational {
+	// multiply two unsigned values into a double-width result, split into high and low halves
+	template<typename UIntT>
+	inline void multiplyWide(const UIntT x, const UIntT y, UIntT& high, UIntT& low) {
+		const int halfBits = (int)(sizeof(UIntT) * CHAR_BIT / 2);
+		const UIntT mask = (UIntT(1) << halfBits) - 1;
+
+		// schoolbook multiplication of the half-width digits
+		UIntT lowLow = (x & mask) * (y & mask);
+		UIntT lowHigh = (x & mask) * (y >> halfBits);
+		UIntT highLow = (x >> halfBits) * (y & mask);
+		UIntT highHigh = (x >> halfBits) * (y >> halfBits);
+
+		UIntT middle = (lowLow >> halfBits) + (lowHigh & mask) + (highLow & mask);
+		low = (lowLow & mask) | (middle << halfBits);
+		high = highHigh + (lowHigh >> halfBits) + (highLow >> halfBits) + (middle >> halfBits);
+	}
+
+	// compare the products a*b and c*d exactly, for integers that have no wider type to multiply in
+	// returns a negative value, zero, or a positive value
+	template<typename IntT, typename UIntT>
+	inline int compareProductsWide(const IntT a, const IntT b, const IntT c, const IntT d) {
+		// the signs decide unless both products have the same sign
+		int signAB = ((a > 0) - (a < 0)) * ((b > 0) - (b < 0));
+		int signCD = ((c > 0) - (c < 0)) * ((d > 0) - (d < 0));
+		if (signAB != signCD) {
+			return (signAB < signCD) ? -1 : 1;
+		}
+		if (signAB == 0) {
+			return 0;
+		}
+
+		// compare the magnitudes -- unsigned, so the minimum value does not overflow
+		UIntT highAB, lowAB, highCD, lowCD;
+		multiplyWide<UIntT>((a < 0) ? UIntT(0) - UIntT(a) : UIntT(a), (b < 0) ? UIntT(0) - UIntT(b) : UIntT(b), highAB, lowAB);
+		multiplyWide<UIntT>((c < 0) ? UIntT(0) - UIntT(c) : UIntT(c), (d < 0) ? UIntT(0) - UIntT(d) : UIntT(d), highCD, lowCD);
+		int result = (highAB != highCD) ? ((highAB < highCD) ? -1 : 1) : (lowAB > lowCD) - (lowAB < lowCD);
+
+		// larger magnitudes are smaller values when both products are negative
+		return (signAB < 0) ? -result : result;
+	}
+
+	// traits for an integer type used as the numerator/denominator of a fraction
+	template<typename IntT>
+	struct IntegerTraits {
+		// built-in integers have a fixed-width unsigned counterpart, used by the binary GCD
+		static const bool is_native = true;
+		typedef typename std::make_unsigned<IntT>::type unsigned_type;
+
+		// largest value of the integer type
+		static IntT max() {
+			return std::numeric_limits<IntT>::max();
+		}
+
+		// absolute value of the integer
+		static IntT abs(const IntT value) {
+			return (value < 0) ? -value : value;
+		}
+
+		// convert the integer to a double
+		static double toDouble(const IntT value) {
+			return static_cast<double>(value);
+		}
+
+		// write the integer to an output stream
+		static void write(std::ostream& os, const IntT value) {
+			os << value;
+		}
+
+		// write the decimal digits of the integer to [first, last), as std::to_chars does
+		static std::to_chars_result toChars(char* first, char* last, const IntT value) {
+			return std::to_chars(first, last, value);
+		}
+
+		// convert the integer to a std::string
+		static std::string toString(const IntT value) {
+			std::ostringstream ss;
+			write(ss, value);
+			return ss.str();
+		}
+
+		// add two integers into result, returning true if the sum overflowed
+		static bool addOverflow(const IntT a, const IntT b, IntT& result) {
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_add_overflow(a, b, &result);
+#else
+			if ((b > 0 && a > std::numeric_limits<IntT>::max() - b) || (b < 0 && a < std::numeric_limits<IntT>::min() - b)) {
+				return true;
+			}
+			result = a + b;
+			return false;
+#endif
+		}
+
+		// subtract two integers into result, returning true if the difference overflowed
+		static bool subOverflow(const IntT a, const IntT b, IntT& result) {
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_sub_overflow(a, b, &result);
+#else
+			if ((b < 0 && a > std::numeric_limits<IntT>::max() + b) || (b > 0 && a < std::numeric_limits<IntT>::min() + b)) {
+				return true;
+			}
+			result = a - b;
+			return false;
+#endif
+		}
+
+		// multiply two integers into result, returning true if the product overflowed
+		static bool mulOverflow(const IntT a, const IntT b, IntT& result) {
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_mul_overflow(a, b, &result);
+#else
+			if (a != 0 && b != 0) {
+				// compare against the limits divided by one operand, depending on the signs involved
+				if (a > 0) {
+					if ((b > 0) ? a > std::numeric_limits<IntT>::max() / b : b < std::numeric_limits<IntT>::min() / a) {
+						return true;
+					}
+				}
+				else if ((b > 0) ? a < std::numeric_limits<IntT>::min() / b : a < std::numeric_limits<IntT>::max() / b) {
+					return true;
+				}
+			}
+			result = a * b;
+			return false;
+#endif
+		}
+
+		// negate an integer into result, returning true if the negation overflowed (the minimum value)
+		static bool negateOverflow(const IntT a, IntT& result) {
+			return subOverflow(IntT(0), a, result);
+		}
+
+		// compare the products a*b and c*d exactly, returning a negative value, zero, or a positive value
+		// the products are computed in a double-width integer, so they never overflow
+		static int compareProducts(const IntT a, const IntT b, const IntT c, const IntT d) {
+			if constexpr (sizeof(IntT) < sizeof(std::int64_t)) {
+				std::int64_t ab = (std::int64_t)a * b;
+				std::int64_t cd = (std::int64_t)c * d;
+				return (ab > cd) - (ab < cd);
+			}
+#ifdef __SIZEOF_INT128__
+			else if constexpr (sizeof(IntT) <= sizeof(std::int64_t)) {
+				__int128 ab = (__int128)a * b;
+				__int128 cd = (__int128)c * d;
+				return (ab > cd) - (ab < cd);
+			}
+#endif
+			else {
+				return compareProductsWide<IntT, unsigned_type>(a, b, c, d);
+			}
+		}
+	};
+
+#ifdef __SIZEOF_INT128__
+	// 128-bit integers have no stream operators, so the digits are produced here
+	template<>
+	struct IntegerTraits<__int128> {
+		// 128-bit integers have a fixed-width unsigned counterpart, used by the binary GCD
+		static const bool is_native = true;
+		typedef unsigned __int128 unsigned_type;
+
+		// largest value of the integer type
+		static __int128 max() {
+			return (__int128)(~(unsigned_type)0 >> 1);
+		}
+
+		// absolute value of the integer
+		static __int128 abs(const __int128 value) {
+			return (value < 0) ? -value : value;
+		}
+
+		// convert the integer to a double
+		static double toDouble(const __int128 value) {
+			return static_cast<double>(value);
+		}
+
+		// write the integer to an output stream
+		static void write(std::ostream& os, const __int128 value) {
+			os << toString(value);
+		}
+
+		// write the decimal digits of the integer to [first, last), as std::to_chars does
+		static std::to_chars_result toChars(char* first, char* last, const __int128 value) {
+			// work with the unsigned magnitude so the minimum value does not overflow on negation
+			unsigned __int128 magnitude = (value < 0) ? -(unsigned __int128)value : (unsigned __int128)value;
+			char digits[40];
+			int pos = sizeof(digits);
+
+			// produce the digits from least to most significant
+			do {
+				digits[--pos] = (char)('0' + (int)(magnitude % 10));
+				magnitude /= 10;
+			} while (magnitude != 0);
+
+			if (value < 0) {
+				digits[--pos] = '-';
+			}
+
+			std::size_t length = sizeof(digits) - pos;
+			if ((std::size_t)(last - first) < length) {
+				return std::to_chars_result{ last, std::errc::value_too_large };
+			}
+			std::copy(digits + pos, digits + sizeof(digits), first);
+			return std::to_chars_result{ first + length, std::errc() };
+		}
+
+		// convert the integer to a std::string
+		static std::string toString(const __int128 value) {
+			char digits[40];
+			return std::string(digits, toChars(digits, digits + sizeof(digits), value).ptr);
+		}
+
+		// add two integers into result, returning true if the sum overflowed
+		static bool addOverflow(const __int128 a, const __int128 b, __int128& result) {
+			return __builtin_add_overflow(a, b, &result);
+		}
+
+		// subtract two integers into result, returning true if the difference overflowed
+		static bool subOverflow(const __int128 a, const __int128 b, __int128& result) {
+			return __builtin_sub_overflow(a, b, &result);
+		}
+
+		// multiply two integers into result, returning true if the product overflowed
+		static bool mulOverflow(const __int128 a, const __int128 b, __int128& result) {
+			return __builtin_mul_overflow(a, b, &result);
+		}
+
+		// negate an integer into result, returning true if the negation overflowed (the minimum value)
+		static bool negateOverflow(const __int128 a, __int128& result) {
+			return __builtin_sub_overflow((__int128)0, a, &result);
+		}
+
+		// compare the products a*b and c*d exactly, returning a negative value, zero, or a positive value
+		static int compareProducts(const __int128 a, const __int128 b, const __int128 c, const __int128 d) {
+			return compareProductsWide<__int128, unsigned __int128>(a, b, c, d);
+		}
+	};
+#endif
+}
+
+#endif
@@ -0,0 +1,130 @@
+/**
+* File: MemoryMappedFile.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Implementation of the read-only memory mapped file, for Windows and POSIX platforms.
+*/
+
+#include "MemoryMappedFile.h"
+#include "InvalidArgumentException.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace rational::exception;
+
+namespace rational {
+#ifdef _WIN32
+	// open the file, then map a read-only view of all of it
+	MemoryMappedFile::MemoryMappedFile(const std::string& fileName) : mappedData(nullptr), mappedSize(0), fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr) {
+		fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE) {
+			throw InvalidArgumentException("Unable to open file", fileName, __FILE__, __LINE__);
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(fileHandle, &fileSize)) {
+			close();
+			throw InvalidArgumentException("Unable to read the size of file", fileName, __FILE__, __LINE__);
+		}
+		mappedSize = (std::size_t)fileSize.QuadPart;
+
+		// an empty file cannot be mapped, and has nothing to map
+		if (mappedSize == 0) {
+			return;
+		}
+
+		mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle != nullptr) {
+			mappedData = (const char*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		}
+		if (mappedData == nullptr) {
+			close();
+			throw InvalidArgumentException("Unable to map file", fileName, __FILE__, __LINE__);
+		}
+	}
+
+	// unmap the view and close the handles
+	void MemoryMappedFile::close() {
+		if (mappedData != nullptr) {
+			UnmapViewOfFile(mappedData);
+			mappedData = nullptr;
+		}
+		if (mappingHandle != nullptr) {
+			CloseHandle(mappingHandle);
+			mappingHandle = nullptr;
+		}
+		if (fileHandle != INVALID_HANDLE_VALUE) {
+			CloseHandle(fileHandle);
+			fileHandle = INVALID_HANDLE_VALUE;
+		}
+	}
+#else
+	// open the file, then map all of it read-only
+	MemoryMappedFile::MemoryMappedFile(const std::string& fileName) : mappedData(nullptr), mappedSize(0), fileDescriptor(-1) {
+		fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+		if (fileDescriptor < 0) {
+			throw InvalidArgumentException("Unable to open file", fileName, __FILE__, __LINE__);
+		}
+
+		struct stat fileStatus;
+		if (::fstat(fileDescriptor, &fileStatus) != 0) {
+			close();
+			throw InvalidArgumentException("Unable to read the size of file", fileName, __FILE__, __LINE__);
+		}
+		mappedSize = (std::size_t)fileStatus.st_size;
+
+		// an empty file cannot be mapped, and has nothing to map
+		if (mappedSize == 0) {
+			return;
+		}
+
+		void* mapping = ::mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		if (mapping == MAP_FAILED) {
+			close();
+			throw InvalidArgumentException("Unable to map file", fileName, __FILE__, __LINE__);
+		}
+		mappedData = (const char*)mapping;
+
+		// the file is read front to back
+		::madvise(mapping, mappedSize, MADV_SEQUENTIAL);
+	}
+
+	// unmap the file and close the descriptor
+	void MemoryMappedFile::close() {
+		if (mappedData != nullptr) {
+			::munmap((void*)mappedData, mappedSize);
+			mappedData = nullptr;
+		}
+		if (fileDescriptor >= 0) {
+			::close(fileDescriptor);
+			fileDescriptor = -1;
+		}
+	}
+#endif
+
+	// destructor
+	MemoryMappedFile::~MemoryMappedFile() {
+		close();
+	}
+
+	// the contents of the file
+	const char* MemoryMappedFile::data() const {
+		return mappedData;
+	}
+
+	// the size of the file
+	std::size_t MemoryMappedFile::size() const {
+		return mappedSize;
+	}
+}
@@ -0,0 +1,52 @@
+/**
+* File: MemoryMappedFile.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This class maps a file read-only into memory for the lifetime of the object, so it can be scanned in place
+* without copying it through a stream. Windows uses a file mapping object; other platforms use POSIX mmap.
+*/
+
+#ifndef MEMORY_MAPPED_FILE_H
+#define MEMORY_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace rational {
+	class MemoryMappedFile {
+	public:
+		// map the file -- throws InvalidArgumentException if it cannot be opened or mapped
+		explicit MemoryMappedFile(const std::string& fileName);
+		// unmap the file
+		~MemoryMappedFile();
+
+		// the mapping is owned by this object, so it cannot be copied
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+		// the contents of the file (nullptr for an empty file)
+		const char* data() const;
+		// the size of the file in bytes
+		std::size_t size() const;
+
+	private:
+		// the mapped contents
+		const char* mappedData;
+		// the mapped size
+		std::size_t mappedSize;
+#ifdef _WIN32
+		// file and mapping handles
+		void* fileHandle;
+		void* mappingHandle;
+#else
+		// file descriptor
+		int fileDescriptor;
+#endif
+
+		// release the mapping and the file
+		void close();
+	};
+}
+
+#endif
@@ -0,0 +1,230 @@
+/**
+* File: MultiplicativeOrder.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header provides the modular arithmetic behind the length of a repeating decimal: the multiplicative order of a base
+* modulo m, the smallest k > 0 with base^k = 1 (mod m). The order divides phi(m), so it is found by factoring m (trial
+* division for small primes, then Pollard's rho with a Miller-Rabin primality test), forming phi(m), and dividing the
+* primes of phi(m) out of it while the power stays 1. The cost grows with the number of digits of m, not with its value.
+* The functions take any unsigned working type W: built-in unsigned integers (64-bit products are formed in 128 bits where
+* the compiler has them, wider ones by doubling and adding) or BigInteger.
+*/
+
+#ifndef MULTIPLICATIVE_ORDER_H
+#define MULTIPLICATIVE_ORDER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "BigInteger.h"
+
+namespace rational {
+	// a + b mod m, for a, b < m -- never forms a value above m, so it cannot wrap
+	template<typename W>
+	inline W addMod(const W& a, const W& b, const W& m) {
+		const W gap = m - b;
+		return (a >= gap) ? W(a - gap) : W(a + b);
+	}
+
+	// a * b mod m, for a, b < m
+	template<typename W>
+	inline W mulMod(const W& a, const W& b, const W& m) {
+		if constexpr (std::is_same<W, BigInteger>::value) {
+			return a * b % m;
+		}
+#ifdef __SIZEOF_INT128__
+		else if constexpr (sizeof(W) <= sizeof(std::uint64_t)) {
+			return (W)((unsigned __int128)a * b % m);
+		}
+#endif
+		else {
+			// the product does not fit -- add a doubling multiple of a for each set bit of b
+			W result = 0;
+			W addend = a;
+			W rest = b;
+			while (rest != 0) {
+				if ((rest & 1) != 0) {
+					result = addMod(result, addend, m);
+				}
+				addend = addMod(addend, addend, m);
+				rest >>= 1;
+			}
+			return result;
+		}
+	}
+
+	// base^exponent mod m, by repeated squaring
+	template<typename W>
+	inline W powMod(W base, W exponent, const W& m) {
+		W result = W(1) % m;
+		base = base % m;
+		while (exponent != W(0)) {
+			if (exponent % W(2) != W(0)) {
+				result = mulMod(result, base, m);
+			}
+			base = mulMod(base, base, m);
+			exponent /= W(2);
+		}
+		return result;
+	}
+
+	// greatest common divisor of two unsigned values
+	template<typename W>
+	inline W gcdMod(W a, W b) {
+		while (b != W(0)) {
+			W rest = a % b;
+			a = b;
+			b = rest;
+		}
+		return a;
+	}
+
+	// Miller-Rabin primality test -- the first twelve prime bases make it exact below 3.3 * 10^24, which covers every 64-bit
+	// value; above that a composite passes with probability below 4^-12
+	template<typename W>
+	inline bool isProbablePrime(const W& n) {
+		static const unsigned int bases[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+		if (n < W(2)) {
+			return false;
+		}
+		for (unsigned int base : bases) {
+			if (n == W(base)) {
+				return true;
+			}
+			if (n % W(base) == W(0)) {
+				return false;
+			}
+		}
+
+		// n - 1 = odd * 2^twos
+		const W nMinusOne = n - W(1);
+		W odd = nMinusOne;
+		unsigned int twos = 0;
+		while (odd % W(2) == W(0)) {
+			odd /= W(2);
+			twos++;
+		}
+		for (unsigned int base : bases) {
+			W x = powMod(W(base), odd, n);
+			if (x == W(1) || x == nMinusOne) {
+				continue;
+			}
+			bool witness = true;
+			for (unsigned int i = 1; i < twos && witness; i++) {
+				x = mulMod(x, x, n);
+				witness = (x != nMinusOne);
+			}
+			if (witness) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// a non-trivial factor of a composite n with no prime factor below 256, by Pollard's rho -- the sequence x -> x^2 + c
+	// repeats modulo a prime factor p of n after about sqrt(p) steps, long before it repeats modulo n. The differences are
+	// multiplied together modulo n, so one GCD covers a batch of steps
+	template<typename W>
+	inline W findFactor(const W& n) {
+		const int BATCH = 64;
+		auto step = [&n](const W& x, const W& c) { return addMod(mulMod(x, x, n), c, n); };
+		auto distance = [](const W& a, const W& b) { return (a > b) ? W(a - b) : W(b - a); };
+		for (W c = W(1); ; c += W(1)) {
+			W slow = W(2);
+			W fast = W(2);
+			W divisor = W(1);
+			while (divisor == W(1)) {
+				const W slowStart = slow;
+				const W fastStart = fast;
+				W product = W(1);
+				for (int i = 0; i < BATCH; i++) {
+					slow = step(slow, c);
+					fast = step(step(fast, c), c);
+					product = mulMod(product, distance(slow, fast), n);
+				}
+				divisor = gcdMod(product, n);
+				if (divisor == n) {
+					// the factors all met within the batch -- repeat it one step at a time
+					slow = slowStart;
+					fast = fastStart;
+					do {
+						slow = step(slow, c);
+						fast = step(step(fast, c), c);
+						divisor = gcdMod(distance(slow, fast), n);
+					} while (divisor == W(1));
+				}
+			}
+			// the sequence repeated modulo n first -- try another constant
+			if (divisor != n) {
+				return divisor;
+			}
+		}
+	}
+
+	// append the prime factors of n (> 0) to primes, each as often as it divides n
+	template<typename W>
+	inline void factorize(W n, std::vector<W>& primes) {
+		for (unsigned int p = 2; p < 256 && W(p) * W(p) <= n; p += (p == 2) ? 1 : 2) {
+			while (n % W(p) == W(0)) {
+				primes.push_back(W(p));
+				n /= W(p);
+			}
+		}
+
+		std::vector<W> pending;
+		if (n != W(1)) {
+			pending.push_back(n);
+		}
+		while (!pending.empty()) {
+			W composite = pending.back();
+			pending.pop_back();
+			if (isProbablePrime(composite)) {
+				primes.push_back(composite);
+			}
+			else {
+				W factor = findFactor(composite);
+				pending.push_back(factor);
+				pending.push_back(composite / factor);
+			}
+		}
+	}
+
+	// the multiplicative order of base modulo m (> 1, and coprime to base)
+	template<typename W>
+	inline W multiplicativeOrder(const W& base, const W& m) {
+		std::vector<W> primes;
+		factorize(m, primes);
+		std::sort(primes.begin(), primes.end());
+
+		// phi(m) is the product of p^(e-1) * (p-1) over the prime powers p^e of m -- its primes are those of each p - 1,
+		// and p itself where e > 1
+		W phi = W(1);
+		std::vector<W> phiPrimes;
+		for (std::size_t i = 0; i < primes.size(); i++) {
+			if (i > 0 && primes[i] == primes[i - 1]) {
+				phi *= primes[i];
+				phiPrimes.push_back(primes[i]);
+			}
+			else {
+				phi *= primes[i] - W(1);
+				factorize(W(primes[i] - W(1)), phiPrimes);
+			}
+		}
+		std::sort(phiPrimes.begin(), phiPrimes.end());
+		phiPrimes.erase(std::unique(phiPrimes.begin(), phiPrimes.end()), phiPrimes.end());
+
+		// the order divides phi(m) -- remove each prime as often as the power stays 1 without it
+		W order = phi;
+		for (const W& p : phiPrimes) {
+			while (order % p == W(0) && powMod(base, W(order / p), m) == W(1)) {
+				order /= p;
+			}
+		}
+		return order;
+	}
+}
+
+#endif
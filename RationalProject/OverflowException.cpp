@@ -0,0 +1,30 @@
+/**
+* File: OverflowException.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This class provides an implementation of an exception type used for indicating when an arithmetic operation overflows the integer type of a Rational
+*/
+
+#include "OverflowException.h"
+
+namespace rational {
+	namespace exception {
+		// construct excepton and supertype
+		OverflowException::OverflowException(std::string fileName, int lineNum) : RationalException("Arithmetic overflow exception", fileName, lineNum) {}
+
+		// destructor
+		OverflowException::~OverflowException() {}
+
+		// what's the exception?
+		const char* OverflowException::what() const throw() {
+			return RationalException::what();
+		}
+
+		// stream overload
+		std::ostream& operator<<(std::ostream& os, const OverflowException& ex) {
+			os << ex.what();
+			return os;
+		}
+	}
+}
@@ -0,0 +1,30 @@
+/**
+* File: OverflowException.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This class provides an implementation of an exception type used for indicating when an arithmetic operation overflows the integer type of a Rational
+*/
+
+#ifndef OVERFLOW_EXCEPTION_H
+#define OVERFLOW_EXCEPTION_H
+
+#include "RationalException.h"
+
+namespace rational {
+	namespace exception {
+		class OverflowException : public RationalException {
+		public:
+			// constructor
+			OverflowException(std::string fileName, int lineNum);
+			// destructor
+			virtual ~OverflowException();
+			// what caused the exception
+			virtual const char* what() const throw();
+			// stream overload
+			friend std::ostream& operator<<(std::ostream& os, const OverflowException& ex);
+		};
+	}
+}
+
+#endif
@@ -2,10 +2,13 @@
  * File: Rational.h
  * Author: Ryan Johnson
  * Email: johnsonrw82@csu.fullerton.edu
- * 
+ *
  * This class provides an implementation of a Rational number
  * It is built on the basics of the Fraction class that was implemented earlier.
  * This class provides comparison, assignment capability, and arithmetic for all rational numbers, including float/double values.
+ * The class is a header-only template over the integer type of the numerator and denominator, so the arithmetic can be
+ * inlined and constant-folded. Rational is the int instantiation; Rational64 and Rational128 use wider integers.
+ * Arithmetic on the native instantiations throws an OverflowException rather than wrapping; BigRational never overflows.
  */
 
 #ifndef RATIONAL_H
@@ -13,228 +16,1960 @@
 
 // superclass header file
 #include "Fraction.h"
-#include <regex>
+#include "BigInteger.h"
+#include "MultiplicativeOrder.h"
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ios>
+#include <istream>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#ifdef __cpp_impl_three_way_comparison
+#include <compare>
+#endif
 
 // namespace -- this class will define functions that may clash with std namespace (such as pow)
 namespace rational {
-	// this class is a fraction, but with more capability
-	class Rational : public Fraction {
+	// print format shared by every Rational instantiation
+	// the format is kept per stream (in an iword slot), so streams on different threads never share format state
+	class RationalFormat {
 	public:
 		// enum declaring print type
 		enum RationalPrintType {
 			DECIMAL, FRACTION
 		};
 
+		// the format the next rational written to the stream uses -- a one-shot usedecimal/usefraction, else the sticky format
+		static RationalPrintType getFormat(std::ios_base& stream);
+		// the sticky format of the stream (FRACTION unless changed with setrationalformat)
+		static RationalPrintType getStickyFormat(std::ios_base& stream);
+		// set the sticky format of the stream, discarding any one-shot format
+		static void setStickyFormat(std::ios_base& stream, const RationalPrintType type);
+		// set a one-shot format, used by the next rational written to the stream only
+		static void setNextFormat(std::ios_base& stream, const RationalPrintType type);
+		// return the format for a rational being written to the stream, and discard any one-shot format
+		static RationalPrintType consumeFormat(std::ios_base& stream);
+
+	private:
+		// format state bits stored in the stream's iword slot (0, the initial value, is sticky fraction)
+		enum FormatFlags {
+			STICKY_DECIMAL = 1, NEXT_DECIMAL = 2, NEXT_FRACTION = 4
+		};
+
+		// the iword index reserved for the format -- allocated once, on first use
+		static int formatIndex();
+	};
+
+	// sticky format manipulator -- the result of setrationalformat
+	struct RationalFormatSetter {
+		RationalFormat::RationalPrintType type;
+	};
+
+	// read/write operators
+	// set flag to use decimal format for the next rational written to the stream
+	std::ostream& usedecimal(std::ostream& os);
+	// set flag to use fraction format for the next rational written to the stream
+	std::ostream& usefraction(std::ostream& os);
+	// set the format of every rational written to the stream, until it is changed again
+	// ex: std::cout << setrationalformat(RationalFormat::DECIMAL) << a << ' ' << b; prints both as decimals
+	RationalFormatSetter setrationalformat(const RationalFormat::RationalPrintType type);
+	std::ostream& operator<<(std::ostream& os, const RationalFormatSetter& setter);
+
+	// iword slot for the format
+	inline int RationalFormat::formatIndex() {
+		static const int index = std::ios_base::xalloc();
+		return index;
+	}
+
+	// stream format accessors
+	inline RationalFormat::RationalPrintType RationalFormat::getFormat(std::ios_base& stream) {
+		long flags = stream.iword(formatIndex());
+		if (flags & NEXT_DECIMAL) {
+			return DECIMAL;
+		}
+		if (flags & NEXT_FRACTION) {
+			return FRACTION;
+		}
+		return (flags & STICKY_DECIMAL) ? DECIMAL : FRACTION;
+	}
+
+	inline RationalFormat::RationalPrintType RationalFormat::getStickyFormat(std::ios_base& stream) {
+		return (stream.iword(formatIndex()) & STICKY_DECIMAL) ? DECIMAL : FRACTION;
+	}
+
+	inline void RationalFormat::setStickyFormat(std::ios_base& stream, const RationalPrintType type) {
+		stream.iword(formatIndex()) = (type == DECIMAL) ? STICKY_DECIMAL : 0;
+	}
+
+	inline void RationalFormat::setNextFormat(std::ios_base& stream, const RationalPrintType type) {
+		long& flags = stream.iword(formatIndex());
+		flags = (flags & STICKY_DECIMAL) | ((type == DECIMAL) ? NEXT_DECIMAL : NEXT_FRACTION);
+	}
+
+	inline RationalFormat::RationalPrintType RationalFormat::consumeFormat(std::ios_base& stream) {
+		RationalPrintType type = getFormat(stream);
+		stream.iword(formatIndex()) &= STICKY_DECIMAL;
+		return type;
+	}
+
+	// the working type of decimal long division -- an unsigned type twice as wide as IntT where one exists, so ten times a
+	// remainder never overflows, otherwise the unsigned type of IntT. Arbitrary precision integers work in their own type
+	template<typename IntT, bool Native = IntegerTraits<IntT>::is_native>
+	struct DecimalDivisionType {
+		typedef IntT type;
+		static const bool is_wide = true;
+	};
+
+	template<typename IntT>
+	struct DecimalDivisionType<IntT, true> {
+#ifdef __SIZEOF_INT128__
+		typedef typename std::conditional<(sizeof(IntT) < sizeof(std::uint64_t)), std::uint64_t,
+			typename std::conditional<(sizeof(IntT) < sizeof(unsigned __int128)), unsigned __int128, typename IntegerTraits<IntT>::unsigned_type>::type>::type type;
+#else
+		typedef typename std::conditional<(sizeof(IntT) < sizeof(std::uint64_t)), std::uint64_t, typename IntegerTraits<IntT>::unsigned_type>::type type;
+#endif
+		static const bool is_wide = sizeof(type) > sizeof(IntT);
+	};
+
+	// a signed type twice as wide as IntT where one exists (64 bits for int, __int128 for 64-bit integers), otherwise IntT
+	// itself -- the sum of two products of IntT values always fits in a wide type
+	template<typename IntT, bool Native = IntegerTraits<IntT>::is_native>
+	struct ProductSumType {
+		typedef IntT type;
+		static const bool is_wide = false;
+	};
+
+	template<typename IntT>
+	struct ProductSumType<IntT, true> {
+#ifdef __SIZEOF_INT128__
+		typedef typename std::conditional<(sizeof(IntT) < sizeof(std::int64_t)), std::int64_t,
+			typename std::conditional<(sizeof(IntT) < sizeof(__int128)), __int128, IntT>::type>::type type;
+#else
+		typedef typename std::conditional<(sizeof(IntT) < sizeof(std::int64_t)), std::int64_t, IntT>::type type;
+#endif
+		static const bool is_wide = sizeof(type) > sizeof(IntT);
+	};
+
+	// one step of the continued fraction expansion of remainderN / remainderD (remainderD > 0): return the next term, the
+	// floor of the quotient, and replace the pair with remainderD and the remainder. The floor makes every remainder (and so
+	// every later term) positive -- only the first numerator can be negative, and the denominator is at least 2 then, so
+	// the adjustment cannot overflow
+	template<typename IntT>
+	inline IntT continuedFractionStep(IntT& remainderN, IntT& remainderD) {
+		IntT term = remainderN / remainderD;
+		IntT remainder = remainderN % remainderD;
+		if (remainder < 0) {
+			term -= 1;
+			remainder += remainderD;
+		}
+		remainderN = remainderD;
+		remainderD = remainder;
+		return term;
+	}
+
+	// one step of decimal long division: return the next digit of remainder / divisor, and replace remainder (< divisor)
+	// with the remainder of ten times it
+	template<typename W, bool Wide>
+	inline int nextDecimalDigit(W& remainder, const W& divisor) {
+		int digit = 0;
+		if constexpr (std::is_same<W, BigInteger>::value) {
+			// the digit is at most 9, so subtracting is cheaper than dividing
+			remainder *= W(10);
+			while (remainder >= divisor) {
+				remainder -= divisor;
+				digit++;
+			}
+		}
+		else if constexpr (Wide) {
+			W scaled = remainder * 10;
+			digit = (int)(scaled / divisor);
+			remainder = scaled % divisor;
+		}
+		else {
+			// ten times the remainder does not fit -- add it ten times modulo the divisor, counting the wraps
+			W sum = 0;
+			for (int i = 0; i < 10; i++) {
+				if (sum >= divisor - remainder) {
+					sum -= divisor - remainder;
+					digit++;
+				}
+				else {
+					sum += remainder;
+				}
+			}
+			remainder = sum;
+		}
+		return digit;
+	}
+
+	// split a double into its sign, odd integer mantissa and binary exponent, so that |value| = mantissa * 2^exponent
+	// throws InvalidArgumentException for infinity and NaN
+	inline void decomposeDouble(const double value, bool& negative, std::uint64_t& mantissa, int& exponent) {
+		if (!std::isfinite(value)) {
+			std::ostringstream ss;
+			ss << value;
+			throw exception::InvalidArgumentException("Cannot convert a non-finite value to a rational", ss.str(), __FILE__, __LINE__);
+		}
+
+		negative = std::signbit(value);
+		if (value == 0) {
+			mantissa = 0;
+			exponent = 0;
+			return;
+		}
+
+		// frexp gives |value| = m * 2^e with m in [0.5, 1) -- scaling m by 2^53 makes it an exact integer
+		int binaryExponent;
+		double fraction = std::frexp(std::fabs(value), &binaryExponent);
+		mantissa = (std::uint64_t)std::ldexp(fraction, std::numeric_limits<double>::digits);
+		exponent = binaryExponent - std::numeric_limits<double>::digits;
+
+		// strip the factors of two, so the mantissa is odd and the fraction is in lowest terms
+		int zeros = countTrailingZeros(mantissa);
+		mantissa >>= zeros;
+		exponent += zeros;
+	}
+
+	// find the closest fraction p/q to n/d (both positive) with q <= bound, using the continued fraction expansion of n/d
+	// W is the working integer type -- the bound checks are arranged so that no intermediate value exceeds n, d or the result
+	template<typename W>
+	inline void closestFraction(const W& n, const W& d, const W& bound, W& p, W& q) {
+		// convergents p1/q1 (latest) and p0/q0 (previous), and the remainders of Euclid's algorithm on n/d
+		W p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+		W remainderN = n, remainderD = d;
+		while (remainderD != 0) {
+			W a = remainderN / remainderD;
+			// stop when the next denominator q0 + a * q1 would exceed the bound
+			if (q1 != 0 && a > (bound - q0) / q1) {
+				break;
+			}
+			W p2 = p0 + a * p1;
+			W q2 = q0 + a * q1;
+			p0 = p1;
+			q0 = q1;
+			p1 = p2;
+			q1 = q2;
+			W nextD = remainderN - a * remainderD;
+			remainderN = remainderD;
+			remainderD = nextD;
+		}
+
+		p = p1;
+		q = q1;
+		if (remainderD != 0) {
+			// the expansion was cut short -- the largest semiconvergent within the bound may be closer than the last convergent
+			W k = (bound - q0) / q1;
+			W semiQ = q0 + k * q1;
+			// the errors are |n*q1 - d*p1| = remainderD and |n*semiQ - d*semiP| = remainderN - k * remainderD,
+			// so the semiconvergent is closer if (remainderN - k * remainderD) / semiQ < remainderD / q1
+			if (IntegerTraits<W>::compareProducts(remainderN - k * remainderD, q1, remainderD, semiQ) < 0) {
+				p = p0 + k * p1;
+				q = semiQ;
+			}
+		}
+	}
+
+	// status of the non-throwing operations (tryAdd, tryDivide, tryParse, ...)
+	enum ArithmeticStatus {
+		STATUS_OK, STATUS_DIVIDE_BY_ZERO, STATUS_OVERFLOW, STATUS_INVALID_FORMAT
+	};
+
+	// this class is a fraction, but with more capability
+	template<typename IntT, typename GcdPolicy = BinaryGcd>
+	class BasicRational : public BasicFraction<IntT, GcdPolicy>, public RationalFormat {
+	public:
+		// the fraction this rational is built on
+		typedef BasicFraction<IntT, GcdPolicy> fraction_type;
+		// the integer type of the numerator and denominator
+		typedef IntT value_type;
+
 		// Constructors
 		// empty constructor
-		Rational();
+		BasicRational();
 		// construct a Rational with a numerator and an optional denominator
-		Rational(const int numerator, const int denominator = 1);
+		BasicRational(const IntT numerator, const IntT denominator = 1);
+		// construct a Rational from an integral value of another type (such as an int literal for a 64-bit rational)
+		template<typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, IntT>::value, int>::type = 0>
+		BasicRational(const T numerator) : BasicRational(static_cast<IntT>(numerator)) {}
 		// construct a rational from a float value
-		Rational(const float floatVal);
+		BasicRational(const float floatVal);
 		// construct a rational from a double value
-		Rational(const double doubleVal);
+		BasicRational(const double doubleVal);
 		// construct a rational from a Fraction
-		Rational(const Fraction& fractionObj);
-		// copy constructor - from another Rational
-		Rational(const Rational& rationalObj);
+		BasicRational(const fraction_type& fractionObj);
+		// copy/move constructors -- the source is already in lowest terms, so these do not reduce again
+		// (the copy still rejects a rational whose denominator was set to 0)
+		BasicRational(const BasicRational& rationalObj);
+		BasicRational(BasicRational&& rationalObj) = default;
+
+		// conversions from floating point
+		// the double constructor (and every float/double overload) converts exactly when the value fits,
+		// and otherwise uses the closest rational that fits -- OverflowException is thrown if the integer part does not fit
+		// return the exact value of the double -- throws OverflowException if it does not fit
+		static BasicRational fromDouble(const double value);
+		// return the closest rational to the double whose denominator does not exceed maxDenominator
+		static BasicRational fromDouble(const double value, const IntT maxDenominator);
+		// return the best rational approximation of the double with a denominator no larger than maxDenominator -- as fromDouble
+		// Ex: approximate(3.14159265, 1000) is 355/113. Throws InvalidArgumentException if maxDenominator is not positive
+		static BasicRational approximate(const double value, const IntT maxDenominator);
 
 		// assignment operators
 		// assign a numerator only
-		Rational operator=(const int numerator);
+		BasicRational& operator=(const int numerator);
 		// assign another Rational
-		Rational operator=(const Rational& rationalObj);
+		BasicRational& operator=(const BasicRational& rationalObj) = default;
+		BasicRational& operator=(BasicRational&& rationalObj) = default;
 		// assign a Fraction
-		Rational operator=(const Fraction& fractionObj);
+		BasicRational& operator=(const fraction_type& fractionObj);
 		// assign a floating point value
-		Rational operator=(const float value);
+		BasicRational& operator=(const float value);
 		// assign a double value
-		Rational operator=(const double value);
+		BasicRational& operator=(const double value);
 
 
 		// binary arithmetic operations
 		// add an int to this rational and return result - non mutating
-		Rational add(const int value);
+		BasicRational add(const int value) const;
 		// add a double to this rational and return result - non mutating
-		Rational add(const double value);
+		BasicRational add(const double value) const;
 		// add a float to this rational and return result - non mutating
-		Rational add(const float value);
+		BasicRational add(const float value) const;
 		// add another Rational to this rational and return result - non mutating
-		Rational add(const Rational& rationalObj);
+		BasicRational add(const BasicRational& rationalObj) const;
 		// subtract an int from this rational and return result
-		Rational subtract(const int value);
+		BasicRational subtract(const int value) const;
 		// subtract a double from this rational and return result
-		Rational subtract(const double value);
+		BasicRational subtract(const double value) const;
 		// subtract a float from this rational and return result
-		Rational subtract(const float value);
+		BasicRational subtract(const float value) const;
 		// subtract another Rational from this rational and return result
-		Rational subtract(const Rational& rationalObj);
+		BasicRational subtract(const BasicRational& rationalObj) const;
 		// multiply this rational by an int and return result
-		Rational multiply(const int value);
+		BasicRational multiply(const int value) const;
 		// multiply this rational by a double and return result
-		Rational multiply(const double value);
+		BasicRational multiply(const double value) const;
 		// multiply this rational by a float and return result
-		Rational multiply(const float value);
+		BasicRational multiply(const float value) const;
 		// multiply this rational by another rational and return result
-		Rational multiply(const Rational& rationalObj);
+		BasicRational multiply(const BasicRational& rationalObj) const;
 		// divide this rational by an int and return result
-		Rational divide(const int value);
+		BasicRational divide(const int value) const;
 		// divide this rational by a double and return result
-		Rational divide(const double value);
+		BasicRational divide(const double value) const;
 		// divide this rational by a float and return result
-		Rational divide(const float value);
+		BasicRational divide(const float value) const;
 		// divide this rational by another Rational and return result
-		Rational divide(const Rational& rationalObj);
+		BasicRational divide(const BasicRational& rationalObj) const;
 		// raise this rational to an integral power and return the result
-		Rational pow(const int value);
+		BasicRational pow(const int value) const;
+
+		// non-throwing arithmetic -- these report division by zero and overflow through the returned status instead of
+		// throwing, so hot loops do not pay for unwinding. result is only written when the status is STATUS_OK,
+		// and may be this rational or the argument. The throwing operators are implemented on top of these.
+		// add another Rational to this rational, storing the sum in result
+		ArithmeticStatus tryAdd(const BasicRational& rationalObj, BasicRational& result) const;
+		// subtract another Rational from this rational, storing the difference in result
+		ArithmeticStatus trySubtract(const BasicRational& rationalObj, BasicRational& result) const;
+		// multiply this rational by another Rational, storing the product in result
+		ArithmeticStatus tryMultiply(const BasicRational& rationalObj, BasicRational& result) const;
+		// divide this rational by another Rational, storing the quotient in result
+		ArithmeticStatus tryDivide(const BasicRational& rationalObj, BasicRational& result) const;
+		// create a rational from a numerator and denominator, storing it (in lowest terms) in result
+		static ArithmeticStatus tryCreate(const IntT numerator, const IntT denominator, BasicRational& result);
 
 		// operator overloads
 		// add an int to this rational and return result - non mutating
-		Rational operator+(const int value);
+		BasicRational operator+(const int value) const;
 		// add a float to this rational and return result - non mutating
-		Rational operator+(const float value);
+		BasicRational operator+(const float value) const;
 		// add a double to this rational and return result - non mutating
-		Rational operator+(const double value);
+		BasicRational operator+(const double value) const;
 		// add another Rational to this rational and return result - non mutating
-		Rational operator+(const Rational& rationalObj);
+		BasicRational operator+(const BasicRational& rationalObj) const;
 		// subtract an int from this rational and return result
-		Rational operator-(const int value);
+		BasicRational operator-(const int value) const;
 		// subtract a float from this rational and return result
-		Rational operator-(const float value);
+		BasicRational operator-(const float value) const;
 		// subtract a double from this rational and return result
-		Rational operator-(const double value);
+		BasicRational operator-(const double value) const;
 		// subtract another Rational from this rational and return result
-		Rational operator-(const Rational& rationalObj);
+		BasicRational operator-(const BasicRational& rationalObj) const;
 		// multiply this rational by an int and return result
-		Rational operator*(const int value);
+		BasicRational operator*(const int value) const;
 		// multiply this rational by a float and return result
-		Rational operator*(const float value);
+		BasicRational operator*(const float value) const;
 		// multiply this rational by a double and return result
-		Rational operator*(const double value);
+		BasicRational operator*(const double value) const;
 		// multiply this rational by another rational and return result
-		Rational operator*(const Rational& rationalObj);
+		BasicRational operator*(const BasicRational& rationalObj) const;
 		// divide this rational by an int and return result
-		Rational operator/(const int value);
+		BasicRational operator/(const int value) const;
 		// divide this rational by a float and return result
-		Rational operator/(const float value);
+		BasicRational operator/(const float value) const;
 		// divide this rational by a double and return result
-		Rational operator/(const double value);
+		BasicRational operator/(const double value) const;
 		// divide this rational by another Rational and return result
-		Rational operator/(const Rational& rationalObj);
+		BasicRational operator/(const BasicRational& rationalObj) const;
 
 		// mutating overloads
 		// modify this rational by adding the specified int
-		Rational operator+=(const int value);
+		BasicRational& operator+=(const int value);
 		// modify this rational by adding the specified float
-		Rational operator+=(const float value);
+		BasicRational& operator+=(const float value);
 		// modify this rational by adding the specified double
-		Rational operator+=(const double value);
+		BasicRational& operator+=(const double value);
 		// modify this rational by adding the specified Rational
-		Rational operator+=(const Rational& rationalObj);
+		BasicRational& operator+=(const BasicRational& rationalObj);
 		// modify this rational by subtracting the specified int
-		Rational operator-=(const int value);
+		BasicRational& operator-=(const int value);
 		// modify this rational by subtracting the specified float
-		Rational operator-=(const float value);
+		BasicRational& operator-=(const float value);
 		// modify this rational by subtracting the specified double
-		Rational operator-=(const double value);
+		BasicRational& operator-=(const double value);
 		// modify this rational by subtracting the specified Rational
-		Rational operator-=(const Rational& rationalObj);
+		BasicRational& operator-=(const BasicRational& rationalObj);
 		// modify this rational by muliplying by the specified int
-		Rational operator*=(const int value);
+		BasicRational& operator*=(const int value);
 		// modify this rational by muliplying by the specified float
-		Rational operator*=(const float value);
+		BasicRational& operator*=(const float value);
 		// modify this rational by muliplying by the specified double
-		Rational operator*=(const double value);
+		BasicRational& operator*=(const double value);
 		// modify this rational by muliplying by the specified Rational
-		Rational operator*=(const Rational& rationalObj);
+		BasicRational& operator*=(const BasicRational& rationalObj);
 		// modify this rational by dividing by the specified int
-		Rational operator/=(const int value);
+		BasicRational& operator/=(const int value);
 		// modify this rational by muliplying by the specified float
-		Rational operator/=(const float value);
+		BasicRational& operator/=(const float value);
 		// modify this rational by muliplying by the specified double
-		Rational operator/=(const double value);
+		BasicRational& operator/=(const double value);
 		// modify this rational by muliplying by the specified Rational
-		Rational operator/=(const Rational& rationalObj);
+		BasicRational& operator/=(const BasicRational& rationalObj);
 
 		// unary arithmetic operations
 		// return the negation of this rational object
-		Rational negate() const;
+		BasicRational negate() const;
 		// return the absolute value of this rational object
-		Rational abs() const;
+		BasicRational abs() const;
 		// return the square of this rational object
-		Rational square() const;
+		BasicRational square() const;
 		// return the inverse (reciprocal) of this rational object
-		Rational inv() const;
+		BasicRational inv() const;
+
+		// continued fractions
+		// return the terms [a0; a1, a2, ...] of the continued fraction of this rational -- a0 is the floor of the value,
+		// and the rest are positive. Ex: 43/30 is [1; 2, 3, 4]. See ContinuedFraction.h to step through the convergents
+		std::vector<IntT> continuedFraction() const;
+		// return the closest rational to this one with a denominator no larger than maxDenominator (this rational, if its
+		// denominator is small enough). Throws InvalidArgumentException if maxDenominator is not positive
+		BasicRational limitDenominator(const IntT maxDenominator) const;
 
 		// logical operations
+		// return a negative value, zero, or a positive value if this rational is less than, equal to, or greater than the supplied rational
+		int compare(const BasicRational& rationalObj) const;
 		// return true if this rational is less than the supplied rational
-		bool lessThan(const Rational& rationalObj) const;
+		bool lessThan(const BasicRational& rationalObj) const;
 		// return true if this rational is less than or equal to the supplied rational
-		bool lessThanEqual(const Rational& rationalObj) const;
+		bool lessThanEqual(const BasicRational& rationalObj) const;
 		// return true if this rational is greater than the supplied rational
-		bool greaterThan(const Rational& rationalObj) const;
+		bool greaterThan(const BasicRational& rationalObj) const;
 		// return true if this rational is greater than or equal to the supplied rational
-		bool greaterThanEqual(const Rational& rationalObj) const;
+		bool greaterThanEqual(const BasicRational& rationalObj) const;
 		// return true if this rational is equal to the supplied rational
-		bool equal(const Rational& rationalObj) const;
+		bool equal(const BasicRational& rationalObj) const;
 
 		// logical operator overloads
 		// return true if this rational is less than the supplied rational
-		bool operator<(const Rational& rationalObj) const;
+		bool operator<(const BasicRational& rationalObj) const;
 		// return true if this rational is less than or equal to the supplied rational
-		bool operator<=(const Rational& rationalObj) const;
+		bool operator<=(const BasicRational& rationalObj) const;
 		// return true if this rational is greater than the supplied rational
-		bool operator>(const Rational& rationalObj) const;
+		bool operator>(const BasicRational& rationalObj) const;
 		// return true if this rational is greater than or equal to the supplied rational
-		bool operator>=(const Rational& rationalObj) const;
+		bool operator>=(const BasicRational& rationalObj) const;
 		// return true if this rational is equal to the supplied rational
-		bool operator==(const Rational& rationalObj) const;
+		bool operator==(const BasicRational& rationalObj) const;
 		// return true if this rational is not equal to the supplied rational
-		bool operator!=(const Rational& rationalObj) const;
+		bool operator!=(const BasicRational& rationalObj) const;
+#ifdef __cpp_impl_three_way_comparison
+		// three way comparison
+		std::strong_ordering operator<=>(const BasicRational& rationalObj) const;
+#endif
 
 		// assignment operations
 		// set the numerator of this rational to the int value
 		void set(const int value);
 		// set the numerator and denominator of this rational
-		void set(const int numerator, const int denominator);
+		void set(const IntT numerator, const IntT denominator);
 		// set this rational to the specified float
 		void set(const float value);
 		// set this rational to the specified double
 		void set(const double value);
 		// set this rational to the Fraction object
-		void set(const Fraction& fractionObj);
+		void set(const fraction_type& fractionObj);
 		// set this Rational to the Rational object
-		void set(const Rational& rationalObj);
+		void set(const BasicRational& rationalObj);
+		// set the numerator or the denominator -- these hide the Fraction setters, and reduce the result to lowest terms
+		// (0/1 with the numerator set to 2 and then the denominator to 4 is 1/2), so every Rational stays in lowest terms.
+		// A zero denominator is stored as it is, making the rational invalid
+		void setNumerator(const IntT numerator);
+		void setDenominator(const IntT denominator);
 
 		// retreival operations are provided by the superclass - Fraction
-		// int getNumerator()
-		// int getDenominator()
+		// IntT getNumerator()
+		// IntT getDenominator()
 		// double toDouble()
 
 		// read/write operations
 		// read Rational object from the specified input stream
 		void read(std::istream& is);
+		// parse "n", "n/d" or decimals such as "-12.5/2.5" from [first, last) without throwing -- trailing whitespace is allowed.
+		// decimals are parsed exactly, as an integer over a power of ten; result is only written when the status is STATUS_OK
+		static ArithmeticStatus tryParse(const char* first, const char* last, BasicRational& result);
 		// write the Rational object to the specified output stream, in the specified format (default is FRACTION form)
-		void write(std::ostream& os, const RationalPrintType type = Rational::FRACTION) const;
+		void write(std::ostream& os, const RationalPrintType type = RationalFormat::FRACTION) const;
+		// format the rational into [first, last) as "n/d" (or "n" for integers), or as the shortest decimal that reads back
+		// as the same double. Returns the end of the text, or errc::value_too_large if it does not fit (as std::to_chars does).
+		// A buffer of MAX_CHARS always fits the native instantiations. Throws DivideByZeroException for a zero denominator
+		std::to_chars_result toChars(char* first, char* last, const RationalPrintType type = RationalFormat::FRACTION) const;
+		// the longest text toChars writes for the native instantiations
+		static constexpr std::size_t MAX_CHARS = 2 * (sizeof(IntT) * CHAR_BIT * 3 / 10 + 3) + 32;
+		// format the exact decimal expansion into [first, last), with digits digits after the point, truncated (not rounded)
+		// Ex: 2/3 with 4 digits is "0.6666". Returns as toChars does
+		std::to_chars_result toDecimalChars(char* first, char* last, const std::size_t digits) const;
+		// format the complete exact decimal expansion into [first, last), with the repeating block in parentheses
+		// Ex: 1/3 is "0.(3)", 1/6 is "0.1(6)" and 1/8 is "0.125". The repeating block can be nearly as long as the denominator;
+		// one that does not fit is reported as errc::value_too_large without generating it. Returns as toChars does
+		std::to_chars_result toRepeatingDecimalChars(char* first, char* last) const;
+		// the number of digits after the point before the repeating block of the decimal expansion, and the length of the block
+		// (0 if the expansion terminates). The block length is found from the factors of the denominator without generating
+		// it, and saturates at SIZE_MAX. Throws DivideByZeroException for a zero denominator
+		void getDecimalPeriod(std::size_t& preperiod, std::size_t& period) const;
+		// the exact decimal expansion as a std::string, as toDecimalChars and toRepeatingDecimalChars. The complete expansion
+		// throws InvalidArgumentException if it has more than maxDigits digits after the point, instead of allocating them
+		std::string toDecimalString(const std::size_t digits) const;
+		std::string toRepeatingDecimalString(const std::size_t maxDigits = MAX_REPEATING_DIGITS) const;
+		// the default limit on the digits of toRepeatingDecimalString
+		static constexpr std::size_t MAX_REPEATING_DIGITS = 1 << 20;
 
-		// read/write operators
-		// set flag to use decimal format on << operations
-		friend std::ostream& usedecimal(std::ostream& os);
 		// i/o operators -- these are used to read/write from a stream using << and >>
 		// write this Rational object to the specified output stream
-		friend std::ostream& operator<<(std::ostream& os, const Rational& rationalObj);
-		// read the Rational object from the specified input stream
-		friend std::istream& operator>>(std::istream& is, Rational& rationalObj);
+		friend std::ostream& operator<<(std::ostream& os, const BasicRational& rationalObj) {
+			rationalObj.write(os, RationalFormat::consumeFormat(os));  // call write (by default, uses fraction format specification)
+			return os;
+		}
+		// read the Rational object from the specified input stream, as numeric extraction does: leading whitespace is skipped,
+		// the value ends at the next whitespace, and a value that cannot be parsed sets failbit instead of throwing
+		friend std::istream& operator>>(std::istream& is, BasicRational& rationalObj) {
+			rationalObj.extract(is);
+			return is;
+		}
 
 		// to-std::string function for this rational object
 		std::string toString() const;
 
 	private:
-		static RationalPrintType defaultPrintType; // default variable for determining the method to print the rational
-
-		// private function that converts a double to fraction (directly using the number of decimal digits defined)
-		Fraction doubleToFraction(const double value);
+		// private function that converts a double to fraction -- exact when it fits, otherwise the closest fraction that fits
+		static fraction_type doubleToFraction(const double value);
+		// convert a double to its exact fraction, returning false if it does not fit
+		static bool exactDoubleToFraction(const double value, fraction_type& fraction);
+		// the closest fraction to a double, with the denominator bounded by maxDenominator and the numerator by the range of IntT
+		static fraction_type approximateDouble(const double value, const IntT maxDenominator);
+		// the closest fraction to n/d, computed in the working integer type W
+		template<typename W>
+		static fraction_type approximateFraction(const bool negative, const W& n, const W& d, const IntT maxDenominator);
+		// return 2^exponent
+		static IntT powerOfTwo(int exponent);
+		// raise an integer to a power by repeated squaring
+		static IntT integerPower(IntT base, unsigned int exponent);
+		// build a rational from a numerator and denominator already in lowest terms, skipping the reduction
+		static BasicRational fromReduced(const IntT numerator, const IntT denominator);
+		// store a numerator and denominator already in lowest terms -- only the sign of the denominator is normalized
+		void setReduced(const IntT numerator, const IntT denominator);
+		// add n1/d1 and n2/d2 (both in lowest terms, with positive denominators) without throwing
+		static ArithmeticStatus tryAddTerms(const IntT n1, const IntT d1, const IntT n2, const IntT d2, BasicRational& result);
+		// multiply n1/d1 by n2/d2 (both in lowest terms, with positive denominators) without throwing
+		static ArithmeticStatus tryMultiplyTerms(const IntT n1, const IntT d1, const IntT n2, const IntT d2, BasicRational& result);
+		// reduce numerator/denominator (with a positive denominator) to lowest terms, and store it in result
+		static void storeReduced(const IntT numerator, const IntT denominator, BasicRational& result);
+		// throw the exception matching a failed status -- does nothing for STATUS_OK
+		static void throwOnError(const ArithmeticStatus status);
+		// parse one side of a rational ("-12.5") into an integer numerator over a power-of-ten denominator, without throwing
+		static ArithmeticStatus tryParseDecimal(const char* first, const char* last, IntT& numerator, IntT& denominator);
+		// parse a run of decimal digits with an optional leading '-', returning false if the value does not fit
+		static bool parseDigits(const char* first, const char* last, IntT& value);
+		// extract one whitespace-delimited value from the stream for operator>> -- sets failbit (leaving this unchanged) on failure
+		void extract(std::istream& is);
+		// the working type of the decimal expansion
+		typedef typename DecimalDivisionType<IntT>::type division_type;
+		// write the sign and integer part of the value into [first, last), and set remainder to the magnitude of the remainder
+		std::to_chars_result toIntegerPartChars(char* first, char* last, division_type& remainder) const;
+		// split the denominator into the length of the non-repeating digits and the factor coprime to 10
+		void splitDenominator(std::size_t& preperiod, division_type& coprime) const;
+		// the order of 10 modulo coprime (> 1, and coprime to 10) -- the length of the repeating block, found from the factors of
+		// coprime (see MultiplicativeOrder.h) in 64-bit arithmetic whenever it fits; returns limit + 1 if the order is more than limit
+		static std::size_t decimalPeriod(const division_type& coprime, const std::size_t limit);
+		// format the result of a to-chars function into a std::string, growing the buffer while it is too small
+		template<typename Format>
+		static std::string formatToString(std::size_t size, Format format);
 	};
+
+	// the rational types -- Rational is the int instantiation used throughout the project
+	typedef BasicRational<int> Rational;
+	typedef BasicRational<std::int32_t> Rational32;
+	typedef BasicRational<std::int64_t> Rational64;
+#ifdef __SIZEOF_INT128__
+	typedef BasicRational<__int128> Rational128;
+#endif
+	// exact rational -- small values use native arithmetic, and promote to arbitrary precision instead of overflowing
+	typedef BasicRational<BigInteger> BigRational;
+
+	// constructors - use initializer lists to init all members
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>::BasicRational() {}
+
+	// this constructor provides a default initialization for denominator, allowing it to be used
+	// for init with a single numerator, or both
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>::BasicRational(const IntT numerator, const IntT denominator) : fraction_type(numerator, denominator) {
+		fraction_type::toLowestTerms(*this);  // reduce to lowest terms
+	}
+	// copy constructor -- a plain copy, with no GCD
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>::BasicRational(const BasicRational& rationalObj) : fraction_type(rationalObj) {
+		// invalid rational
+		if (this->getDenominator() == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+	}
+	// call the double version of this constructor
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>::BasicRational(const float floatVal) : BasicRational((double)floatVal) {}
+	// create a Rational from a Fraction
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>::BasicRational(const fraction_type& fractionObj) : fraction_type(fractionObj) {
+		fraction_type::toLowestTerms(*this);  // reduce to lowest terms
+	}
+
+	// this constructor will use a double value to create a fraction object using a helper function
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>::BasicRational(const double doubleVal) : fraction_type(doubleToFraction(doubleVal)) {
+		fraction_type::toLowestTerms(*this);  // reduce to lowest terms
+	}
+
+
+	// assignment overloads
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator=(const int numerator) {
+		// move from a temporary -- overloaded function
+		return *this = BasicRational(numerator);
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator=(const float value) {
+		// overloaded function
+		return *this = (double)value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator=(const double value) {
+		// move from a temporary
+		return *this = BasicRational(value);
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator=(const fraction_type& fractionObj) {
+		// the fraction may not be in lowest terms, so it is reduced on the way in
+		return *this = BasicRational(fractionObj);
+	}
+
+	// operator overloads -- these are implemented in terms of their mutating counterparts
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator+(const int value) const {
+		BasicRational tmp(*this);
+		tmp += value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator+(const float value) const {
+		BasicRational tmp(*this);
+		tmp += value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator+(const double value) const {
+		BasicRational tmp(*this);
+		tmp += value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator+(const BasicRational& rationalObj) const {
+		BasicRational tmp(*this);
+		tmp += rationalObj;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator-(const int value) const {
+		BasicRational tmp(*this);
+		tmp -= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator-(const float value) const {
+		BasicRational tmp(*this);
+		tmp -= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator-(const double value) const {
+		BasicRational tmp(*this);
+		tmp -= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator-(const BasicRational& rationalObj) const {
+		BasicRational tmp(*this);
+		tmp -= rationalObj;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator*(const int value) const {
+		BasicRational tmp(*this);
+		tmp *= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator*(const float value) const {
+		BasicRational tmp(*this);
+		tmp *= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator*(const double value) const {
+		BasicRational tmp(*this);
+		tmp *= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator*(const BasicRational& rationalObj) const {
+		BasicRational tmp(*this);
+		tmp *= rationalObj;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator/(const int value) const {
+		BasicRational tmp(*this);
+		tmp /= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator/(const float value) const {
+		BasicRational tmp(*this);
+		tmp /= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator/(const double value) const {
+		BasicRational tmp(*this);
+		tmp /= value;
+		return tmp;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::operator/(const BasicRational& rationalObj) const {
+		BasicRational tmp(*this);
+		tmp /= rationalObj;
+		return tmp;
+	}
+
+	// binary operations -- the four major operations are implemented in terms of their in-fix counterparts
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::add(const int value) const {
+		return *this + value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::add(const double value) const {
+		return *this + value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::add(const float value) const {
+		return *this + value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::add(const BasicRational& rationalObj) const {
+		return *this + rationalObj;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::subtract(const int value) const {
+		return *this - value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::subtract(const double value) const {
+		return *this - value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::subtract(const float value) const {
+		return *this - value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::subtract(const BasicRational& rationalObj) const {
+		return *this - rationalObj;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::multiply(const int value) const {
+		return *this * value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::multiply(const double value) const {
+		return *this * value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::multiply(const float value) const {
+		return *this * value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::multiply(const BasicRational& rationalObj) const {
+		return *this * rationalObj;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::divide(const int value) const {
+		return *this / value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::divide(const double value) const {
+		return *this / value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::divide(const float value) const {
+		return *this / value;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::divide(const BasicRational& rationalObj) const {
+		return *this / rationalObj;
+	}
+
+	// raise this rational to an integral power
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::pow(const int value) const {
+		// invalid rational
+		if (this->getDenominator() == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		// the magnitude of the exponent, computed in unsigned so the minimum int does not overflow
+		unsigned int exponent = (value < 0) ? 0u - (unsigned int)value : (unsigned int)value;
+
+		// raise the numerator and denominator separately -- powers of coprime integers are coprime,
+		// so the result is already in lowest terms
+		BasicRational result = fromReduced(integerPower(this->getNumerator(), exponent), integerPower(this->getDenominator(), exponent));
+
+		// a negative power is the inverse of the positive power
+		return (value < 0) ? result.inv() : result;
+	}
+
+	// build a rational that is already in lowest terms -- only the sign of the denominator is normalized
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::fromReduced(const IntT numerator, const IntT denominator) {
+		BasicRational result;
+		result.setReduced(numerator, denominator);
+		return result;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::setReduced(const IntT numerator, const IntT denominator) {
+		fraction_type::setNumerator(numerator);
+		fraction_type::setDenominator(denominator);
+	}
+
+	// raise an integer to a power by repeated squaring -- throws OverflowException if the result does not fit
+	template<typename IntT, typename GcdPolicy>
+	inline IntT BasicRational<IntT, GcdPolicy>::integerPower(IntT base, unsigned int exponent) {
+		IntT result = 1;
+		while (exponent != 0) {
+			if (exponent & 1) {
+				result = fraction_type::checkedMultiply(result, base);
+			}
+			exponent >>= 1;
+			// the last square is not needed, and could overflow even though the result fits
+			if (exponent != 0) {
+				base = fraction_type::checkedMultiply(base, base);
+			}
+		}
+		return result;
+	}
+
+	// mutating operator overloads
+	// addition
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator+=(const int value) {
+		return *this += BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator+=(const float value) {
+		return *this += (double)value;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator+=(const double value) {
+		return *this += BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator+=(const BasicRational& rationalObj) {
+		// the result is reduced once, and stored directly in this rational
+		throwOnError(tryAdd(rationalObj, *this));
+		return *this;
+	}
+
+	// subtraction
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator-=(const int value) {
+		return *this -= BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator-=(const float value) {
+		return *this -= (double)value;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator-=(const double value) {
+		return *this -= BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator-=(const BasicRational& rationalObj) {
+		// the result is reduced once, and stored directly in this rational
+		throwOnError(trySubtract(rationalObj, *this));
+		return *this;
+	}
+
+	// multiplication
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator*=(const int value) {
+		return *this *= BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator*=(const float value) {
+		return *this *= (double)value;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator*=(const double value) {
+		return *this *= BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator*=(const BasicRational& rationalObj) {
+		// the result is reduced once, and stored directly in this rational
+		throwOnError(tryMultiply(rationalObj, *this));
+		return *this;
+	}
+
+	// division
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator/=(const int value) {
+		return *this /= BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator/=(const float value) {
+		return *this /= (double)value;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator/=(const double value) {
+		return *this /= BasicRational(value);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy>& BasicRational<IntT, GcdPolicy>::operator/=(const BasicRational& rationalObj) {
+		// the result is reduced once, and stored directly in this rational
+		throwOnError(tryDivide(rationalObj, *this));
+		return *this;
+	}
+
+	// non-throwing arithmetic
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryAdd(const BasicRational& rationalObj, BasicRational& result) const {
+		// invalid rationals
+		if (this->getDenominator() == 0 || rationalObj.getDenominator() == 0) {
+			return STATUS_DIVIDE_BY_ZERO;
+		}
+		return tryAddTerms(this->getNumerator(), this->getDenominator(), rationalObj.getNumerator(), rationalObj.getDenominator(), result);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::trySubtract(const BasicRational& rationalObj, BasicRational& result) const {
+		// invalid rationals
+		if (this->getDenominator() == 0 || rationalObj.getDenominator() == 0) {
+			return STATUS_DIVIDE_BY_ZERO;
+		}
+
+		// add the negation
+		IntT negated;
+		if (fraction_type::traits_type::negateOverflow(rationalObj.getNumerator(), negated)) {
+			return STATUS_OVERFLOW;
+		}
+		return tryAddTerms(this->getNumerator(), this->getDenominator(), negated, rationalObj.getDenominator(), result);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryMultiply(const BasicRational& rationalObj, BasicRational& result) const {
+		// invalid rationals
+		if (this->getDenominator() == 0 || rationalObj.getDenominator() == 0) {
+			return STATUS_DIVIDE_BY_ZERO;
+		}
+		return tryMultiplyTerms(this->getNumerator(), this->getDenominator(), rationalObj.getNumerator(), rationalObj.getDenominator(), result);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryDivide(const BasicRational& rationalObj, BasicRational& result) const {
+		// invalid rationals, or division by zero
+		if (this->getDenominator() == 0 || rationalObj.getDenominator() == 0 || rationalObj.getNumerator() == 0) {
+			return STATUS_DIVIDE_BY_ZERO;
+		}
+
+		// multiply by the reciprocal, moving its sign to the numerator
+		IntT numerator = rationalObj.getDenominator();
+		IntT denominator = rationalObj.getNumerator();
+		if (denominator < 0) {
+			if (fraction_type::traits_type::negateOverflow(denominator, denominator)) {
+				return STATUS_OVERFLOW;
+			}
+			numerator = -numerator;
+		}
+		return tryMultiplyTerms(this->getNumerator(), this->getDenominator(), numerator, denominator, result);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryCreate(const IntT numerator, const IntT denominator, BasicRational& result) {
+		if (denominator == 0) {
+			return STATUS_DIVIDE_BY_ZERO;
+		}
+
+		// move the sign to the numerator
+		IntT n = numerator;
+		IntT d = denominator;
+		if (d < 0 && (fraction_type::traits_type::negateOverflow(n, n) || fraction_type::traits_type::negateOverflow(d, d))) {
+			return STATUS_OVERFLOW;
+		}
+		storeReduced(n, d, result);
+		return STATUS_OK;
+	}
+
+	// add two reduced fractions, cancelling common factors first so the intermediates stay near the size of the result
+	// (Knuth, TAOCP vol. 2, 4.5.1): with d1 = gcd(b, d), a/b + c/d = t / ((b/d1) * (d/d2)), where t = a*(d/d1) + c*(b/d1)
+	// and d2 = gcd(t, d1) -- the result is already in lowest terms, and d1 is usually 1, leaving only one GCD.
+	// t itself can be up to d1 times larger than the result's numerator, so it is formed in the double-width type where
+	// there is one, and only t/d2 has to fit. Without a wider type (__int128) an overflowing t reports STATUS_OVERFLOW
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryAddTerms(const IntT n1, const IntT d1, const IntT n2, const IntT d2, BasicRational& result) {
+		typedef typename fraction_type::traits_type traits;
+		IntT denominatorGcd = GcdPolicy::gcd(d1, d2);
+		IntT multiplier1 = d2 / denominatorGcd;
+		IntT multiplier2 = d1 / denominatorGcd;
+
+		// t can only share factors with d1 -- coprime denominators need no second GCD
+		IntT numerator, numeratorGcd;
+		if constexpr (ProductSumType<IntT>::is_wide) {
+			typedef typename ProductSumType<IntT>::type wide_type;
+			const wide_type sum = (wide_type)n1 * multiplier1 + (wide_type)n2 * multiplier2;
+			if (sum == 0) {
+				// a zero sum is 0/1
+				result.setReduced(0, 1);
+				return STATUS_OK;
+			}
+			// gcd(t, d1) = gcd(t mod d1, d1), which is computed in IntT
+			numeratorGcd = (denominatorGcd == 1) ? IntT(1) : GcdPolicy::gcd((IntT)(sum % denominatorGcd), denominatorGcd);
+			const wide_type reduced = (numeratorGcd == 1) ? sum : sum / numeratorGcd;
+			if (reduced > (wide_type)std::numeric_limits<IntT>::max() || reduced < (wide_type)std::numeric_limits<IntT>::min()) {
+				return STATUS_OVERFLOW;
+			}
+			numerator = (IntT)reduced;
+		}
+		else {
+			IntT term1, term2, sum;
+			if (traits::mulOverflow(n1, multiplier1, term1) ||
+				traits::mulOverflow(n2, multiplier2, term2) ||
+				traits::addOverflow(term1, term2, sum)) {
+				return STATUS_OVERFLOW;
+			}
+			if (sum == 0) {
+				// a zero sum is 0/1
+				result.setReduced(0, 1);
+				return STATUS_OK;
+			}
+			numeratorGcd = (denominatorGcd == 1) ? IntT(1) : GcdPolicy::gcd(sum, denominatorGcd);
+			numerator = sum / numeratorGcd;
+		}
+
+		IntT denominator;
+		if (traits::mulOverflow(multiplier2, d2 / numeratorGcd, denominator)) {
+			return STATUS_OVERFLOW;
+		}
+		result.setReduced(numerator, denominator);
+		return STATUS_OK;
+	}
+
+	// multiply two reduced fractions, cancelling across them first (Knuth, TAOCP vol. 2, 4.5.1):
+	// a/b * c/d = ((a/g1) * (c/g2)) / ((b/g2) * (d/g1)), with g1 = gcd(a, d) and g2 = gcd(c, b) -- the result is in lowest terms,
+	// and only overflows if the reduced result does not fit
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryMultiplyTerms(const IntT n1, const IntT d1, const IntT n2, const IntT d2, BasicRational& result) {
+		typedef typename fraction_type::traits_type traits;
+		// a zero product is 0/1
+		if (n1 == 0 || n2 == 0) {
+			result.setReduced(0, 1);
+			return STATUS_OK;
+		}
+
+		IntT gcd1 = GcdPolicy::gcd(n1, d2);
+		IntT gcd2 = GcdPolicy::gcd(n2, d1);
+		IntT numerator, denominator;
+		if (traits::mulOverflow(n1 / gcd1, n2 / gcd2, numerator) || traits::mulOverflow(d1 / gcd2, d2 / gcd1, denominator)) {
+			return STATUS_OVERFLOW;
+		}
+		result.setReduced(numerator, denominator);
+		return STATUS_OK;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::storeReduced(const IntT numerator, const IntT denominator, BasicRational& result) {
+		// a zero fraction is 0/1
+		if (numerator == 0) {
+			result.setReduced(0, 1);
+			return;
+		}
+
+		IntT gcd = GcdPolicy::gcd(numerator, denominator);
+		result.setReduced(numerator / gcd, denominator / gcd);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::throwOnError(const ArithmeticStatus status) {
+		if (status == STATUS_DIVIDE_BY_ZERO) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+		if (status == STATUS_OVERFLOW) {
+			throw exception::OverflowException(__FILE__, __LINE__);
+		}
+	}
+
+	// unary arithmetic operations
+	// return the negation of this rational object
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::negate() const {
+		// negate by multiplying numerator by -1 -- the result stays in lowest terms
+		return fromReduced(fraction_type::checkedNegate(this->getNumerator()), this->getDenominator());
+	}
+	// return the absolute value of this rational object
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::abs() const {
+		// the denominator is already positive -- the result stays in lowest terms
+		return fromReduced(fraction_type::checkedAbs(this->getNumerator()), this->getDenominator());
+	}
+
+	// return the square of this rational object
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::square() const {
+		// invalid rational
+		if (this->getDenominator() == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		// fast path for pow(2) -- two checked multiplies, and no reduction since the square of a reduced rational is reduced
+		return fromReduced(fraction_type::checkedMultiply(this->getNumerator(), this->getNumerator()), fraction_type::checkedMultiply(this->getDenominator(), this->getDenominator()));
+	}
+
+	// return the inverse (reciprocal) of this rational object
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::inv() const {
+		fraction_type fraction = *this;
+
+		// fraction's method to invert;
+		fraction = fraction.inv();
+
+		// the reciprocal of a reduced rational is reduced -- only the sign needed moving, which the fraction did
+		return fromReduced(fraction.getNumerator(), fraction.getDenominator());
+	}
+
+	// the continued fraction, one term per step of Euclid's algorithm (see continuedFractionStep)
+	template<typename IntT, typename GcdPolicy>
+	inline std::vector<IntT> BasicRational<IntT, GcdPolicy>::continuedFraction() const {
+		if (this->getDenominator() == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		std::vector<IntT> terms;
+		IntT remainderN = this->getNumerator();
+		IntT remainderD = this->getDenominator();
+		while (remainderD != 0) {
+			terms.push_back(continuedFractionStep(remainderN, remainderD));
+		}
+		return terms;
+	}
+
+	// the closest rational with a bounded denominator, from the continued fraction of the magnitude
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::limitDenominator(const IntT maxDenominator) const {
+		if (maxDenominator < 1) {
+			throw exception::InvalidArgumentException("Maximum denominator must be positive", fraction_type::traits_type::toString(maxDenominator), __FILE__, __LINE__);
+		}
+		if (this->getDenominator() == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+		if (this->getDenominator() <= maxDenominator) {
+			return *this;
+		}
+
+		const IntT numerator = this->getNumerator();
+		const bool negative = numerator < 0;
+		if constexpr (fraction_type::traits_type::is_native) {
+			// the magnitude of the most negative value does not fit in IntT
+			if (numerator < -fraction_type::traits_type::max()) {
+				return BasicRational(approximateFraction<BigInteger>(true, -BigInteger(numerator), BigInteger(this->getDenominator()), maxDenominator));
+			}
+		}
+		return BasicRational(approximateFraction<IntT>(negative, negative ? -numerator : numerator, this->getDenominator(), maxDenominator));
+	}
+
+	// three way comparison -- the rationals are compared by cross-multiplying in a double-width integer,
+	// so no common denominator (or intermediate fractions) are needed and the comparison cannot overflow
+	template<typename IntT, typename GcdPolicy>
+	inline int BasicRational<IntT, GcdPolicy>::compare(const BasicRational& rationalObj) const {
+		// denominators are kept positive, so a common denominator compares by numerator alone
+		if (this->getDenominator() == rationalObj.getDenominator()) {
+			return (this->getNumerator() > rationalObj.getNumerator()) - (this->getNumerator() < rationalObj.getNumerator());
+		}
+
+		// a/b <=> c/d is the same as a*d <=> c*b
+		return fraction_type::traits_type::compareProducts(this->getNumerator(), rationalObj.getDenominator(), rationalObj.getNumerator(), this->getDenominator());
+	}
+
+	// logical operator overloads -- implemented in terms of compare()
+	// Less-than operator, returns true if this rational is less than the supplied rational
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::operator<(const BasicRational& rationalObj) const {
+		return compare(rationalObj) < 0;
+	}
+	// Less-than-or-equal operator, returns true if this rational is less than or equal to the supplied rational
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::operator<=(const BasicRational& rationalObj) const {
+		return compare(rationalObj) <= 0;
+	}
+
+	// Greater-than operator, returns true if this rational is greater than the supplied rational
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::operator>(const BasicRational& rationalObj) const {
+		return compare(rationalObj) > 0;
+	}
+	// Greater-than-or-equal operator, returns true if this rational is greater than or equal to the supplied rational
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::operator>=(const BasicRational& rationalObj) const {
+		return compare(rationalObj) >= 0;
+	}
+	// equality operator -- returns true if this rational is equal to the supplied rational
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::operator==(const BasicRational& rationalObj) const {
+		return compare(rationalObj) == 0;
+	}
+
+	// not-equal operator, returns true if this rational is not equal to the supplied rational
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::operator!=(const BasicRational& rationalObj) const {
+		return compare(rationalObj) != 0;
+	}
+
+#ifdef __cpp_impl_three_way_comparison
+	// three way comparison operator
+	template<typename IntT, typename GcdPolicy>
+	inline std::strong_ordering BasicRational<IntT, GcdPolicy>::operator<=>(const BasicRational& rationalObj) const {
+		return compare(rationalObj) <=> 0;
+	}
+#endif
+
+	// logical operations -- implemented in terms of operator overloaded functions
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::lessThan(const BasicRational& rationalObj) const {
+		return *this < rationalObj;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::lessThanEqual(const BasicRational& rationalObj) const {
+		return *this <= rationalObj;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::greaterThan(const BasicRational& rationalObj) const {
+		return *this > rationalObj;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::greaterThanEqual(const BasicRational& rationalObj) const {
+		return *this >= rationalObj;
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::equal(const BasicRational& rationalObj) const {
+		return *this == rationalObj;
+	}
+
+	// assignment operations
+	// the setters store through the Fraction, then reduce -- unless the denominator is 0, which would become 1 for a zero numerator
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::setNumerator(const IntT numerator) {
+		fraction_type::setNumerator(numerator);
+		if (this->getDenominator() != 0) {
+			fraction_type::toLowestTerms(*this);
+		}
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::setDenominator(const IntT denominator) {
+		fraction_type::setDenominator(denominator);
+		if (this->getDenominator() != 0) {
+			fraction_type::toLowestTerms(*this);
+		}
+	}
+
+	// these operations are implemented in terms of their overloaded assignment variants
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::set(const int value) {
+		*this = value;  // use overloaded assignment operator
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::set(const IntT numerator, const IntT denominator) {
+		*this = BasicRational(numerator, denominator); // use overloaded assignment operator
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::set(const float value) {
+		*this = value; // use overloaded assignment operator
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::set(const double value) {
+		*this = value; // use overloaded assignment operator
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::set(const fraction_type& fractionObj) {
+		*this = fractionObj; // use overloaded assignment operator
+	}
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::set(const BasicRational& rationalObj) {
+		*this = rationalObj; // use overloaded assignment operator
+	}
+
+	// read/write operations
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::read(std::istream& is) {
+		std::string line;
+		std::getline(is, line);
+
+		BasicRational value;
+		ArithmeticStatus status = tryParse(line.data(), line.data() + line.size(), value);
+		if (status == STATUS_INVALID_FORMAT) {
+			throw exception::InvalidFormatException(line, __FILE__, __LINE__);
+		}
+		throwOnError(status);
+
+		*this = value;
+	}
+
+	// extract a value -- the token is gathered on the stack, and only a token too long for it (arbitrary precision) uses the heap
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::extract(std::istream& is) {
+		typedef std::istream::traits_type stream_traits;
+		// skips leading whitespace, and sets failbit at the end of the stream
+		std::istream::sentry sentry(is);
+		if (!sentry) {
+			return;
+		}
+
+		const std::ctype<char>& ctype = std::use_facet<std::ctype<char>>(is.getloc());
+		std::streambuf* buffer = is.rdbuf();
+		std::ios_base::iostate state = std::ios_base::goodbit;
+		char token[MAX_CHARS];
+		std::size_t length = 0;
+		std::string longToken;
+		for (stream_traits::int_type c = buffer->sgetc(); ; c = buffer->snextc()) {
+			if (stream_traits::eq_int_type(c, stream_traits::eof())) {
+				state |= std::ios_base::eofbit;
+				break;
+			}
+			// the whitespace that ends the value is left in the stream
+			char ch = stream_traits::to_char_type(c);
+			if (ctype.is(std::ctype_base::space, ch)) {
+				break;
+			}
+			if (length == sizeof(token)) {
+				longToken.append(token, length);
+				length = 0;
+			}
+			token[length++] = ch;
+		}
+
+		BasicRational value;
+		ArithmeticStatus status;
+		if (longToken.empty()) {
+			status = tryParse(token, token + length, value);
+		}
+		else {
+			longToken.append(token, length);
+			status = tryParse(longToken.data(), longToken.data() + longToken.size(), value);
+		}
+		if (status == STATUS_OK) {
+			*this = value;
+		}
+		else {
+			state |= std::ios_base::failbit;
+		}
+		is.setstate(state);
+	}
+
+	// parse a rational -- the grammar is a decimal, optionally followed by a single / and another decimal, where a decimal
+	// is an optional '-', digits, and an optional '.' followed by at least one digit (the digits before the '.' may be omitted)
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryParse(const char* first, const char* last, BasicRational& result) {
+		// trailing whitespace is allowed
+		while (last != first && (last[-1] == ' ' || last[-1] == '\t' || last[-1] == '\r' || last[-1] == '\n' || last[-1] == '\v' || last[-1] == '\f')) {
+			last--;
+		}
+
+		// split on the slash -- a second slash is rejected as a non-digit in the denominator
+		const char* slash = std::find(first, last, '/');
+		IntT n1, d1;
+		IntT n2 = 1, d2 = 1;
+		ArithmeticStatus status = tryParseDecimal(first, slash, n1, d1);
+		if (status == STATUS_OK && slash != last) {
+			status = tryParseDecimal(slash + 1, last, n2, d2);
+		}
+		if (status != STATUS_OK) {
+			return status;
+		}
+		if (n2 == 0) {
+			return STATUS_DIVIDE_BY_ZERO;
+		}
+
+		// integers on both sides (the common case) need a single reduction
+		if (d1 == 1 && d2 == 1) {
+			return tryCreate(n1, n2, result);
+		}
+
+		// (n1/d1) / (n2/d2) -- the powers of ten are cancelled before anything is multiplied
+		BasicRational numerator, denominator;
+		status = tryCreate(n1, d1, numerator);
+		if (status == STATUS_OK) {
+			status = tryCreate(n2, d2, denominator);
+		}
+		return (status == STATUS_OK) ? numerator.tryDivide(denominator, result) : status;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicRational<IntT, GcdPolicy>::tryParseDecimal(const char* first, const char* last, IntT& numerator, IntT& denominator) {
+		typedef typename fraction_type::traits_type traits;
+		const bool negative = (first != last && *first == '-');
+		const char* digits = negative ? first + 1 : first;
+
+		// the integer digits, and the fraction digits after the point
+		const char* point = std::find(digits, last, '.');
+		const char* fractionFirst = (point == last) ? last : point + 1;
+		if ((point == last) ? (digits == last) : (fractionFirst == last)) {
+			return STATUS_INVALID_FORMAT; // no digits, or nothing after the point
+		}
+		for (const char* c = digits; c != last; c++) {
+			if ((*c < '0' || *c > '9') && c != point) {
+				return STATUS_INVALID_FORMAT;
+			}
+		}
+
+		// trailing zeros after the point do not change the value, and would only make the power of ten larger
+		const char* fractionLast = last;
+		while (fractionLast != fractionFirst && fractionLast[-1] == '0') {
+			fractionLast--;
+		}
+
+		// numerator = integer part * 10^k + fraction digits (with the sign), over 10^k
+		IntT integerPart = 0;
+		IntT fractionPart = 0;
+		IntT scale = 1;
+		if ((digits != point && !parseDigits(first, point, integerPart)) ||
+			(fractionFirst != fractionLast && !parseDigits(fractionFirst, fractionLast, fractionPart)) ||
+			(negative && traits::negateOverflow(fractionPart, fractionPart))) {
+			return STATUS_OVERFLOW;
+		}
+		for (const char* c = fractionFirst; c != fractionLast; c++) {
+			if (traits::mulOverflow(scale, IntT(10), scale)) {
+				return STATUS_OVERFLOW;
+			}
+		}
+		if (traits::mulOverflow(integerPart, scale, integerPart) || traits::addOverflow(integerPart, fractionPart, numerator)) {
+			return STATUS_OVERFLOW;
+		}
+		denominator = scale;
+		return STATUS_OK;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::parseDigits(const char* first, const char* last, IntT& value) {
+		if constexpr (std::is_integral<IntT>::value && sizeof(IntT) <= sizeof(long long)) {
+			// the digits are already validated, so from_chars can only fail if the value does not fit
+			return std::from_chars(first, last, value).ec == std::errc();
+		}
+		else {
+			// wider integers -- accumulate with the sign, so the minimum value fits
+			typedef typename fraction_type::traits_type traits;
+			const bool negative = (first != last && *first == '-');
+			value = 0;
+			for (const char* c = negative ? first + 1 : first; c != last; c++) {
+				IntT digit = *c - '0';
+				if (traits::mulOverflow(value, IntT(10), value) || (negative ? traits::subOverflow(value, digit, value) : traits::addOverflow(value, digit, value))) {
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	// writes to output stream using specified format (default/not specified is fraction)
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::write(std::ostream& os, const RationalPrintType type) const {
+		// format into a buffer on the stack -- only arbitrary precision values can outgrow it
+		char buffer[MAX_CHARS];
+		std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer), type);
+		if (result.ec == std::errc()) {
+			os.write(buffer, result.ptr - buffer);
+		}
+		else {
+			os << toString(); // decimals always fit, so this is a fraction
+		}
+	}
+
+	// format the rational into a character buffer
+	template<typename IntT, typename GcdPolicy>
+	inline std::to_chars_result BasicRational<IntT, GcdPolicy>::toChars(char* first, char* last, const RationalPrintType type) const {
+		typedef typename fraction_type::traits_type traits;
+		// invalid rational
+		if (this->getDenominator() == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		if (type == RationalFormat::DECIMAL) {
+			double value = this->toDouble();
+#if defined(__cpp_lib_to_chars)
+			// shortest representation that round trips
+			return std::to_chars(first, last, value);
+#else
+			// without floating point to_chars, find the shortest precision that round trips
+			char digits[32];
+			int length = 0;
+			for (int precision = std::numeric_limits<double>::digits10; precision <= std::numeric_limits<double>::max_digits10; precision++) {
+				length = std::snprintf(digits, sizeof(digits), "%.*g", precision, value);
+				if (std::strtod(digits, nullptr) == value) {
+					break;
+				}
+			}
+			if (last - first < length) {
+				return std::to_chars_result{ last, std::errc::value_too_large };
+			}
+			return std::to_chars_result{ std::copy(digits, digits + length, first), std::errc() };
+#endif
+		}
+
+		// the rational is kept in lowest terms, so it is written as it is
+		std::to_chars_result result = traits::toChars(first, last, this->getNumerator());
+		if (result.ec != std::errc() || this->getDenominator() == 1) {
+			return result;
+		}
+		if (result.ptr == last) {
+			return std::to_chars_result{ last, std::errc::value_too_large };
+		}
+		*result.ptr = '/';
+		return traits::toChars(result.ptr + 1, last, this->getDenominator());
+	}
+
+	// exact decimal expansion, truncated to a number of digits
+	template<typename IntT, typename GcdPolicy>
+	inline std::to_chars_result BasicRational<IntT, GcdPolicy>::toDecimalChars(char* first, char* last, const std::size_t digits) const {
+		division_type remainder;
+		std::to_chars_result result = toIntegerPartChars(first, last, remainder);
+		if (result.ec != std::errc() || digits == 0) {
+			return result;
+		}
+		if ((std::size_t)(last - result.ptr) <= digits) {
+			return std::to_chars_result{ last, std::errc::value_too_large };
+		}
+
+		*result.ptr++ = '.';
+		const division_type divisor = division_type(this->getDenominator());
+		char* digitsEnd = result.ptr + digits;
+		// once the remainder is 0, the rest of the digits are too
+		for (; result.ptr != digitsEnd && remainder != division_type(0); result.ptr++) {
+			*result.ptr = (char)('0' + nextDecimalDigit<division_type, DecimalDivisionType<IntT>::is_wide>(remainder, divisor));
+		}
+		result.ptr = std::fill_n(result.ptr, digitsEnd - result.ptr, '0');
+		return result;
+	}
+
+	// complete decimal expansion, with the repeating block in parentheses
+	template<typename IntT, typename GcdPolicy>
+	inline std::to_chars_result BasicRational<IntT, GcdPolicy>::toRepeatingDecimalChars(char* first, char* last) const {
+		division_type remainder;
+		std::to_chars_result result = toIntegerPartChars(first, last, remainder);
+		if (result.ec != std::errc() || remainder == division_type(0)) {
+			return result;
+		}
+
+		// the point and the non-repeating digits, then the repeating block and its parentheses
+		std::size_t preperiod;
+		division_type coprime;
+		splitDenominator(preperiod, coprime);
+		std::size_t available = last - result.ptr;
+		if (available < preperiod + 1) {
+			return std::to_chars_result{ last, std::errc::value_too_large };
+		}
+		std::size_t period = 0;
+		if (coprime != division_type(1)) {
+			std::size_t limit = available - preperiod - 1;
+			period = decimalPeriod(coprime, (limit > 2) ? limit - 2 : 0);
+			if (period + 2 > limit) {
+				return std::to_chars_result{ last, std::errc::value_too_large };
+			}
+		}
+
+		*result.ptr++ = '.';
+		const division_type divisor = division_type(this->getDenominator());
+		for (std::size_t i = 0; i < preperiod; i++) {
+			*result.ptr++ = (char)('0' + nextDecimalDigit<division_type, DecimalDivisionType<IntT>::is_wide>(remainder, divisor));
+		}
+		if (period != 0) {
+			*result.ptr++ = '(';
+			for (std::size_t i = 0; i < period; i++) {
+				*result.ptr++ = (char)('0' + nextDecimalDigit<division_type, DecimalDivisionType<IntT>::is_wide>(remainder, divisor));
+			}
+			*result.ptr++ = ')';
+		}
+		return result;
+	}
+
+	// length of the non-repeating digits and of the repeating block
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::getDecimalPeriod(std::size_t& preperiod, std::size_t& period) const {
+		// invalid rational
+		if (this->getDenominator() == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		division_type coprime;
+		splitDenominator(preperiod, coprime);
+		period = (coprime == division_type(1)) ? 0 : decimalPeriod(coprime, std::numeric_limits<std::size_t>::max() - 1);
+	}
+
+	// exact decimal expansions as strings
+	template<typename IntT, typename GcdPolicy>
+	inline std::string BasicRational<IntT, GcdPolicy>::toDecimalString(const std::size_t digits) const {
+		return formatToString(MAX_CHARS + digits, [this, digits](char* first, char* last) {
+			return toDecimalChars(first, last, digits);
+		});
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline std::string BasicRational<IntT, GcdPolicy>::toRepeatingDecimalString(const std::size_t maxDigits) const {
+		std::size_t preperiod, period;
+		getDecimalPeriod(preperiod, period);
+		if (period > maxDigits || preperiod > maxDigits - period) {
+			throw exception::InvalidArgumentException("Decimal expansion is longer than the digit limit", std::to_string(maxDigits), __FILE__, __LINE__);
+		}
+		return formatToString(MAX_CHARS + preperiod + period, [this](char* first, char* last) {
+			return toRepeatingDecimalChars(first, last);
+		});
+	}
+
+	// the sign and integer part -- the quotient truncates toward zero, so the remainder has the sign of the numerator
+	template<typename IntT, typename GcdPolicy>
+	inline std::to_chars_result BasicRational<IntT, GcdPolicy>::toIntegerPartChars(char* first, char* last, division_type& remainder) const {
+		typedef typename fraction_type::traits_type traits;
+		const IntT numerator = this->getNumerator();
+		const IntT denominator = this->getDenominator();
+		// invalid rational
+		if (denominator == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		remainder = division_type(0);
+		if (denominator == 1) {
+			return traits::toChars(first, last, numerator);
+		}
+
+		// with a denominator of at least 2, neither the quotient nor the remainder is the minimum value, so both negate
+		IntT quotient = numerator / denominator;
+		IntT rest = numerator % denominator;
+		if (numerator < 0) {
+			if (first == last) {
+				return std::to_chars_result{ last, std::errc::value_too_large };
+			}
+			*first++ = '-';
+			quotient = -quotient;
+			rest = -rest;
+		}
+		remainder = division_type(rest);
+		return traits::toChars(first, last, quotient);
+	}
+
+	// the denominator is 2^a * 5^b * coprime -- the digits before the repeating block number max(a, b)
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicRational<IntT, GcdPolicy>::splitDenominator(std::size_t& preperiod, division_type& coprime) const {
+		std::size_t twos = 0;
+		std::size_t fives = 0;
+		coprime = division_type(this->getDenominator());
+		while (coprime % division_type(2) == division_type(0)) {
+			coprime /= division_type(2);
+			twos++;
+		}
+		while (coprime % division_type(5) == division_type(0)) {
+			coprime /= division_type(5);
+			fives++;
+		}
+		preperiod = std::max(twos, fives);
+	}
+
+	// the multiplicative order of 10 modulo coprime
+	template<typename IntT, typename GcdPolicy>
+	inline std::size_t BasicRational<IntT, GcdPolicy>::decimalPeriod(const division_type& coprime, const std::size_t limit) {
+		auto toUInt64 = [](const division_type& value) -> std::uint64_t {
+			if constexpr (std::is_same<division_type, BigInteger>::value) {
+				return value.template toIntegral<std::uint64_t>();
+			}
+			else {
+				return (std::uint64_t)value;
+			}
+		};
+
+		// the order is at most coprime - 1, so a 64-bit coprime has a 64-bit order
+		std::uint64_t order;
+		if constexpr (std::is_same<division_type, std::uint64_t>::value) {
+			order = multiplicativeOrder<std::uint64_t>(10, coprime);
+		}
+		else {
+			if (coprime > division_type(std::numeric_limits<std::uint64_t>::max())) {
+				const division_type wideOrder = multiplicativeOrder(division_type(10), coprime);
+				return (wideOrder > division_type(limit)) ? limit + 1 : (std::size_t)toUInt64(wideOrder);
+			}
+			order = multiplicativeOrder<std::uint64_t>(10, toUInt64(coprime));
+		}
+		return (order > limit) ? limit + 1 : (std::size_t)order;
+	}
+
+	// format into a string buffer, doubling it until the text fits
+	template<typename IntT, typename GcdPolicy>
+	template<typename Format>
+	inline std::string BasicRational<IntT, GcdPolicy>::formatToString(std::size_t size, Format format) {
+		std::string text(size, '\0');
+		std::to_chars_result result = format(&text[0], &text[0] + text.size());
+		while (result.ec != std::errc()) {
+			text.resize(text.size() * 2);
+			result = format(&text[0], &text[0] + text.size());
+		}
+		text.resize(result.ptr - text.data());
+		return text;
+	}
+
+	// set print flags
+	// this allows the user to use the << operator and specify the format
+	// ex: std::cout << usedecimal << Rational(1,2); will output "0.5"
+	inline std::ostream& usedecimal(std::ostream& os) {
+		RationalFormat::setNextFormat(os, RationalFormat::DECIMAL);
+		return os;
+	}
+
+	// ex: std::cout << setrationalformat(RationalFormat::DECIMAL) << usefraction << Rational(1,2); will output "1/2"
+	inline std::ostream& usefraction(std::ostream& os) {
+		RationalFormat::setNextFormat(os, RationalFormat::FRACTION);
+		return os;
+	}
+
+	// sticky format manipulator
+	inline RationalFormatSetter setrationalformat(const RationalFormat::RationalPrintType type) {
+		return RationalFormatSetter{ type };
+	}
+
+	inline std::ostream& operator<<(std::ostream& os, const RationalFormatSetter& setter) {
+		RationalFormat::setStickyFormat(os, setter.type);
+		return os;
+	}
+
+	// to string implementation
+	template<typename IntT, typename GcdPolicy>
+	inline std::string BasicRational<IntT, GcdPolicy>::toString() const {
+		char buffer[MAX_CHARS];
+		std::to_chars_result result = toChars(buffer, buffer + sizeof(buffer));
+		if (result.ec == std::errc()) {
+			return std::string(buffer, result.ptr);
+		}
+
+		// only arbitrary precision values can outgrow the buffer
+		typedef typename fraction_type::traits_type traits;
+		std::string text = traits::toString(this->getNumerator());
+		if (this->getDenominator() != 1) {
+			text += "/" + traits::toString(this->getDenominator());
+		}
+		return text;
+	}
+
+	// convert a double value to a Fraction
+	// the value is converted exactly when it fits in IntT (Ex: 2.75 yields 11/4), otherwise the closest fraction that fits is used
+	// (Ex: 0.1, which is not exactly representable as a double, yields 1/10 for Rational)
+	template<typename IntT, typename GcdPolicy>
+	inline typename BasicRational<IntT, GcdPolicy>::fraction_type BasicRational<IntT, GcdPolicy>::doubleToFraction(const double value) {
+		fraction_type fraction;
+		if (exactDoubleToFraction(value, fraction)) {
+			return fraction;
+		}
+
+		// only native integers can fail to hold the exact value
+		if constexpr (fraction_type::traits_type::is_native) {
+			return approximateDouble(value, fraction_type::traits_type::max());
+		}
+		else {
+			throw exception::OverflowException(__FILE__, __LINE__);
+		}
+	}
+
+	// convert a double to its exact fraction -- mantissa / 2^-exponent, or mantissa * 2^exponent
+	template<typename IntT, typename GcdPolicy>
+	inline bool BasicRational<IntT, GcdPolicy>::exactDoubleToFraction(const double value, fraction_type& fraction) {
+		bool negative;
+		std::uint64_t mantissa;
+		int exponent;
+		decomposeDouble(value, negative, mantissa, exponent);
+
+		// the mantissa is odd, so its bit count is the number of bits the double carries
+		int mantissaBits = 0;
+		for (std::uint64_t bits = mantissa; bits != 0; bits >>= 1) {
+			mantissaBits++;
+		}
+
+		if constexpr (fraction_type::traits_type::is_native) {
+			// bits available in the (signed) integer type
+			const int digits = (int)(sizeof(IntT) * CHAR_BIT) - 1;
+			if ((exponent >= 0 && mantissaBits + exponent > digits) || (exponent < 0 && (mantissaBits > digits || -exponent >= digits))) {
+				return false;
+			}
+		}
+
+		IntT numerator = (IntT)mantissa;
+		IntT denominator = 1;
+		if (exponent >= 0) {
+			numerator *= powerOfTwo(exponent);
+		}
+		else {
+			denominator = powerOfTwo(-exponent);
+		}
+
+		fraction = fraction_type(negative ? -numerator : numerator, denominator);
+		return true;
+	}
+
+	// find the closest fraction to the double within the bounds
+	// doubles whose exact fraction fits in 64 bits are searched in native arithmetic, the rest in BigInteger
+	template<typename IntT, typename GcdPolicy>
+	inline typename BasicRational<IntT, GcdPolicy>::fraction_type BasicRational<IntT, GcdPolicy>::approximateDouble(const double value, const IntT maxDenominator) {
+		if (maxDenominator < 1) {
+			throw exception::InvalidArgumentException("Maximum denominator must be positive", fraction_type::traits_type::toString(maxDenominator), __FILE__, __LINE__);
+		}
+
+		bool negative;
+		std::uint64_t mantissa;
+		int exponent;
+		decomposeDouble(value, negative, mantissa, exponent);
+
+		if constexpr (fraction_type::traits_type::is_native && sizeof(IntT) <= sizeof(std::int64_t)) {
+			if (exponent <= 0 && exponent > -63) {
+				return approximateFraction<std::int64_t>(negative, (std::int64_t)mantissa, (std::int64_t)1 << -exponent, maxDenominator);
+			}
+		}
+
+		// |value| = n / d
+		BigInteger n(mantissa);
+		BigInteger d(1);
+		for (int i = 0; i < std::abs(exponent); i += 32) {
+			BigInteger factor((std::uint64_t)1 << std::min(32, std::abs(exponent) - i));
+			if (exponent >= 0) {
+				n *= factor;
+			}
+			else {
+				d *= factor;
+			}
+		}
+		return approximateFraction<BigInteger>(negative, n, d, maxDenominator);
+	}
+
+	// the closest fraction to n/d, in the working integer type W, with the denominator bounded by maxDenominator
+	// and the numerator bounded by the range of IntT
+	template<typename IntT, typename GcdPolicy>
+	template<typename W>
+	inline typename BasicRational<IntT, GcdPolicy>::fraction_type BasicRational<IntT, GcdPolicy>::approximateFraction(const bool negative, const W& n, const W& d, const IntT maxDenominator) {
+		W bound = (d < W(maxDenominator)) ? d : W(maxDenominator);
+		if constexpr (fraction_type::traits_type::is_native) {
+			// keep the numerator in range too: p < (floor(n/d) + 1) * q + 1
+			W numeratorBound = (W(fraction_type::traits_type::max()) - 1) / (n / d + 1);
+			if (numeratorBound < bound) {
+				bound = (numeratorBound < 1) ? W(1) : numeratorBound;
+			}
+		}
+
+		W p, q;
+		closestFraction(n, d, bound, p, q);
+
+		if constexpr (fraction_type::traits_type::is_native) {
+			// the bounds keep the result in range, unless the integer part itself does not fit
+			if (p > W(fraction_type::traits_type::max())) {
+				throw exception::OverflowException(__FILE__, __LINE__);
+			}
+		}
+
+		IntT numerator, denominator;
+		if constexpr (std::is_same<W, BigInteger>::value && !std::is_same<IntT, BigInteger>::value) {
+			numerator = p.template toIntegral<IntT>();
+			denominator = q.template toIntegral<IntT>();
+		}
+		else {
+			numerator = (IntT)p;
+			denominator = (IntT)q;
+		}
+		return fraction_type(negative ? -numerator : numerator, denominator);
+	}
+
+	// 2^exponent, for exponents known to fit -- built in 30-bit steps so it also works for BigInteger
+	template<typename IntT, typename GcdPolicy>
+	inline IntT BasicRational<IntT, GcdPolicy>::powerOfTwo(int exponent) {
+		IntT result = 1;
+		for (; exponent >= 30; exponent -= 30) {
+			result *= IntT(1 << 30);
+		}
+		return result * IntT(1 << exponent);
+	}
+
+	// return the exact value of the double
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::fromDouble(const double value) {
+		fraction_type fraction;
+		if (!exactDoubleToFraction(value, fraction)) {
+			throw exception::OverflowException(__FILE__, __LINE__);
+		}
+		return BasicRational(fraction);
+	}
+
+	// return the closest rational to the double with a bounded denominator
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::fromDouble(const double value, const IntT maxDenominator) {
+		return BasicRational(approximateDouble(value, maxDenominator));
+	}
+
+	// the best rational approximation of a double
+	template<typename IntT, typename GcdPolicy>
+	inline BasicRational<IntT, GcdPolicy> BasicRational<IntT, GcdPolicy>::approximate(const double value, const IntT maxDenominator) {
+		return fromDouble(value, maxDenominator);
+	}
 }
 
-#endif
\ No newline at end of file
+#endif
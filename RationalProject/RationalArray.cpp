@@ -4,20 +4,37 @@
 * Email: johnsonrw82@csu.fullerton.edu
 *
 * This class provides an implementation of a RationalArray, a container of Rational number objects
-* This class uses a fixed-size native array to provide storage for Rational objects
-* The class provides basic container operations, and should eventually update to allow dynamic memory allocation and re-sizing
+* The elements are stored by value in one contiguous buffer; only the slots in use hold constructed Rationals, and growing
+* the container moves the elements into a single new buffer
 */
 
 #include "RationalArray.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
 #include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 
 using namespace rational::exception;
 
+// growing moves the elements, which must not throw part way through
+static_assert(std::is_nothrow_move_constructible<Rational>::value, "Rational must be nothrow move constructible");
+
 // constructor
 RationalArray::RationalArray() : RationalArray(INIT_CAPACITY) {}
 
 // constructor with initial size
-RationalArray::RationalArray(int initialSize) {
+RationalArray::RationalArray(int initialSize) : inlineStorage(nullptr), inlineCapacity(0) {
 	if (initialSize <= 0) {
 		std::stringstream ss;
 		ss << initialSize;
@@ -32,30 +49,64 @@ RationalArray::RationalArray(int initialSize) {
 	count = 0;  // empty
 }
 
-// copy constructor
-RationalArray::RationalArray(const RationalArray& ra) {
-	count = ra.count;
+// copy constructor -- the elements are copied into storage of their own
+RationalArray::RationalArray(const RationalArray& ra) : inlineStorage(nullptr), inlineCapacity(0) {
+	count = 0;
 	maxCapacity = ra.maxCapacity;
 	initArray(rationalArray, maxCapacity);
 	// copy
-	for (unsigned int i = 0; i < maxCapacity; i++) {
-		rationalArray[i] = ra.rationalArray[i];
-	}
+	std::uninitialized_copy(ra.rationalArray, ra.rationalArray + ra.count, rationalArray);
+	count = ra.count;
 }
 
+// move constructor
+RationalArray::RationalArray(RationalArray&& ra) noexcept : rationalArray(nullptr), count(0), maxCapacity(0), inlineStorage(nullptr), inlineCapacity(0) {
+	*this = std::move(ra);
+}
+
+// constructor for derived classes, which provide the inline storage
+RationalArray::RationalArray(Rational* inlineStorage, std::size_t inlineCapacity)
+	: rationalArray(inlineStorage), count(0), maxCapacity(inlineCapacity), inlineStorage(inlineStorage), inlineCapacity(inlineCapacity) {}
+
 // destructor
 RationalArray::~RationalArray() {
 	// this will be called on a fully constructed object, guaranteed
-	freeArray(rationalArray);
+	freeArray(rationalArray, size());
 }
 
 // assignment operator
 RationalArray& RationalArray::operator=(const RationalArray& ra) {
 	RationalArray tmp(ra); // make a copy
 
-	std::swap(maxCapacity, tmp.maxCapacity);
-	std::swap(count, tmp.count);
-	std::swap(rationalArray, tmp.rationalArray);
+	// the copy has heap storage, so it is always taken whole
+	return *this = std::move(tmp);
+}
+
+// move assignment operator -- the old elements are freed
+RationalArray& RationalArray::operator=(RationalArray&& ra) noexcept {
+	if (this == &ra) {
+		return *this;
+	}
+
+	if (!ra.usesInlineStorage()) {
+		// take ra's storage, and return ra to its inline storage (if it has any)
+		freeArray(rationalArray, size());
+		rationalArray = ra.rationalArray;
+		count = ra.count;
+		maxCapacity = ra.maxCapacity;
+
+		ra.rationalArray = ra.inlineStorage;
+		ra.count = 0;
+		ra.maxCapacity = ra.inlineCapacity;
+	}
+	else {
+		// inline storage belongs to ra, so its elements are moved one by one
+		clear();
+		reserve(ra.size());
+		std::uninitialized_move(ra.begin(), ra.end(), rationalArray);
+		count = ra.count;
+		ra.clear();
+	}
 
 	return *this;
 }
@@ -65,8 +116,8 @@ bool RationalArray::operator==(const RationalArray& ra) const {
 	bool isEqual = size() == ra.size() && capacity() == ra.capacity();
 	if (isEqual) {
 		// check each element
-		for (unsigned int i = 0; i < size(); i++) {
-			isEqual &= *rationalArray[i] == *ra.rationalArray[i];
+		for (std::size_t i = 0; i < size(); i++) {
+			isEqual &= rationalArray[i] == ra.rationalArray[i];
 			if (!isEqual) {
 				break;
 			}
@@ -84,7 +135,7 @@ bool RationalArray::operator!=(const RationalArray& ra) const {
 // throws an ArrayIndexOutOfBoundsException if the index exceeds the bounds of the underlying container
 Rational RationalArray::retrieve(int index) const {
 	if (index >= 0 && (unsigned int)index < size()) {
-		return *rationalArray[index];
+		return rationalArray[index];
 	}	
 	else {
 		throw ArrayIndexOutOfBoundsException(index, __FILE__, __LINE__);
@@ -96,11 +147,15 @@ Rational RationalArray::retrieve(int index) const {
 void RationalArray::add(const Rational& rationalObj) {
 	// if the array is too small, resize and copy
 	if (size() >= maxCapacity) {
+		// rationalObj may be one of the elements, so it is copied before they move
+		Rational element(rationalObj);
 		maxCapacity = resizeAndCopy(rationalArray, size());  // resize and copy - assign result to new capacity
+		new (rationalArray + size()) Rational(std::move(element));
+	}
+	else {
+		// construct in the first unused slot
+		new (rationalArray + size()) Rational(rationalObj);
 	}
-
-	// add to the array
-	*rationalArray[size()] = rationalObj;
 
 	// increment count
 	count++;
@@ -114,11 +169,23 @@ void RationalArray::add(Rational* rationalPtr) {
 	}
 }
 
+// construct a Rational at the end of the container
+Rational& RationalArray::emplace_back(const int numerator, const int denominator) {
+	if (size() >= maxCapacity) {
+		maxCapacity = resizeAndCopy(rationalArray, size());
+	}
+
+	// if the constructor throws, the slot stays unused
+	Rational* element = new (rationalArray + size()) Rational(numerator, denominator);
+	count++;
+	return *element;
+}
+
 // replace the specified rational object at index, with rationalObj
 void RationalArray::replace(int index, const Rational& rationalObj) {
 	// prevent under/over indexing
 	if (index >= 0 && (unsigned int)index < size()) {
-		*rationalArray[index] = rationalObj;
+		rationalArray[index] = rationalObj;
 	}
 	else {
 		throw ArrayIndexOutOfBoundsException(index, __FILE__, __LINE__);
@@ -134,12 +201,11 @@ void RationalArray::replace(int index, Rational* rationalPtr) {
 // remove rational from index and return
 Rational RationalArray::remove(int index) {
 	if (index >= 0 && (unsigned int) index < size()) {
-		Rational removeElement = *rationalArray[index];
+		Rational removeElement = rationalArray[index];
 
-		// shift all elements from index+1 down by 1
-		for (unsigned int i = index + 1; i < size(); i++) {
-			rationalArray[i - 1] = rationalArray[i];
-		}
+		// shift all elements from index+1 down by 1, and destroy the last slot
+		std::move(rationalArray + index + 1, rationalArray + size(), rationalArray + index);
+		rationalArray[size() - 1].~Rational();
 
 		// decrement index
 		count--;
@@ -151,24 +217,163 @@ Rational RationalArray::remove(int index) {
 	}
 }
 
-// reset the array to initial size
+// remove every element -- the storage is kept for the next elements
 void RationalArray::clear() {
-	// free resources
-	freeArray(rationalArray);
-	// initialize resources
-	initArray(rationalArray, INIT_CAPACITY);
+	std::destroy(rationalArray, rationalArray + size());
 
 	// reset count
 	count = 0;
-	// max capacity
-	maxCapacity = INIT_CAPACITY;
 }
 
-// print the contents of the array
+// grow the capacity, so the next newCapacity - size() adds do not resize
+void RationalArray::reserve(std::size_t newCapacity) {
+	if (newCapacity > maxCapacity) {
+		copyToCapacity(rationalArray, size(), newCapacity);
+		maxCapacity = newCapacity;
+	}
+}
+
+// add or remove elements at the end, so there are newSize
+void RationalArray::resize(std::size_t newSize) {
+	if (newSize < size()) {
+		std::destroy(rationalArray + newSize, rationalArray + size());
+	}
+	else {
+		// grow geometrically, as add does, so a run of small resizes does not move every element each time
+		if (newSize > maxCapacity) {
+			reserve(std::max(newSize, growCapacity(maxCapacity)));
+		}
+		std::uninitialized_value_construct(rationalArray + size(), rationalArray + newSize);
+	}
+	count = newSize;
+}
+
+// move the elements to storage that just fits them
+void RationalArray::shrink_to_fit() {
+	if (usesInlineStorage()) {
+		// inline storage cannot shrink
+		return;
+	}
+
+	if (inlineStorage != nullptr && size() <= inlineCapacity) {
+		// the elements fit inline again
+		std::uninitialized_move(begin(), end(), inlineStorage);
+		freeArray(rationalArray, size());
+		rationalArray = inlineStorage;
+		maxCapacity = inlineCapacity;
+	}
+	else if (maxCapacity > size()) {
+		copyToCapacity(rationalArray, size(), size());
+		maxCapacity = count;
+	}
+}
+
+// raise every element to the specified power
+void RationalArray::pow(const int exponent) {
+	// compute every power before storing any, so an OverflowException leaves the container unchanged
+	std::vector<Rational> results;
+	results.reserve(size());
+	for (std::size_t i = 0; i < size(); i++) {
+		// squaring is the common case, and has a faster path than the general power
+		results.push_back((exponent == 2) ? rationalArray[i].square() : rationalArray[i].pow(exponent));
+	}
+
+	for (std::size_t i = 0; i < size(); i++) {
+		rationalArray[i] = results[i];
+	}
+}
+
+// bound the denominator of every element
+void RationalArray::limitDenominator(const int maxDenominator) {
+	if (maxDenominator < 1) {
+		throw InvalidArgumentException("Maximum denominator must be positive", std::to_string(maxDenominator), __FILE__, __LINE__);
+	}
+
+	// elements within the bound are left as they are; the rest are approximated in place, which cannot fail
+	for (std::size_t i = 0; i < size(); i++) {
+		if (rationalArray[i].getDenominator() > maxDenominator) {
+			rationalArray[i] = rationalArray[i].limitDenominator(maxDenominator);
+		}
+	}
+}
+
+// add the approximations of a list of doubles
+void RationalArray::addApproximations(const std::vector<double>& values, const int maxDenominator) {
+	// approximate every value before adding any, so an exception leaves the container unchanged
+	std::vector<Rational> results;
+	results.reserve(values.size());
+	for (double value : values) {
+		results.push_back(Rational::approximate(value, maxDenominator));
+	}
+
+	reserve(size() + results.size());
+	for (const Rational& rationalObj : results) {
+		add(rationalObj);
+	}
+}
+
+// print the contents of the array, in the format set on std::cout
 void RationalArray::printArray() const {
-	for (unsigned int i = 0; i < size(); i++) {
-		std::cout << *(rationalArray[i]) << std::endl;
+	writeTo(std::cout);
+	if (size() > 0) {
+		std::cout << '\n';
 	}
+	std::cout.flush();
+}
+
+// format the elements into a buffer, handing it to the sink whenever the next element might not fit
+void RationalArray::writeTo(const Sink& sink, const Rational::RationalPrintType type, const std::string& separator) const {
+	std::vector<char> buffer(std::max(WRITE_BUFFER_SIZE, 2 * (Rational::MAX_CHARS + separator.size())));
+	char* const bufferEnd = buffer.data() + buffer.size();
+	char* out = buffer.data();
+	for (std::size_t i = 0; i < size(); i++) {
+		if ((std::size_t)(bufferEnd - out) < Rational::MAX_CHARS + separator.size()) {
+			sink(buffer.data(), out - buffer.data());
+			out = buffer.data();
+		}
+
+		if (i > 0) {
+			out = std::copy(separator.begin(), separator.end(), out);
+		}
+		out = rationalArray[i].toChars(out, bufferEnd, type).ptr;
+	}
+
+	if (out != buffer.data()) {
+		sink(buffer.data(), out - buffer.data());
+	}
+}
+
+// write the elements to a stream, in the format set on it
+void RationalArray::writeTo(std::ostream& os, const std::string& separator) const {
+	writeTo(os, RationalFormat::consumeFormat(os), separator);
+}
+
+// write the elements to a stream
+void RationalArray::writeTo(std::ostream& os, const Rational::RationalPrintType type, const std::string& separator) const {
+	writeTo([&os](const char* data, std::size_t size) {
+		os.write(data, size);
+	}, type, separator);
+}
+
+// write the elements to a file descriptor, retrying partial writes
+void RationalArray::writeTo(int fileDescriptor, const Rational::RationalPrintType type, const std::string& separator) const {
+	writeTo([fileDescriptor](const char* data, std::size_t size) {
+		while (size > 0) {
+#ifdef _WIN32
+			int written = _write(fileDescriptor, data, (unsigned int)std::min<std::size_t>(size, INT_MAX));
+#else
+			ssize_t written = ::write(fileDescriptor, data, size);
+			if (written < 0 && errno == EINTR) {
+				continue;
+			}
+#endif
+			if (written < 0) {
+				throw InvalidArgumentException("Unable to write to file descriptor", std::to_string(fileDescriptor), __FILE__, __LINE__);
+			}
+			data += written;
+			size -= written;
+		}
+	}, type, separator);
 }
 
 // return the number of elements in the container
@@ -182,39 +387,47 @@ std::size_t RationalArray::capacity() const {
 }
 
 // private function that will resize the reference container to specified size and copy elements
-std::size_t RationalArray::resizeAndCopy(Rational **&originalArray, std::size_t size) {
-	unsigned int newSize = (unsigned int)(size * 1.5); // grow by 1.5
+std::size_t RationalArray::resizeAndCopy(Rational *&originalArray, std::size_t size) {
+	std::size_t newSize = growCapacity(size);
+
+	copyToCapacity(originalArray, size, newSize);
+
+	return newSize;
+}
+
+// grow by 1.5
+std::size_t RationalArray::growCapacity(std::size_t size) {
+	std::size_t newSize = size + size / 2;
 	if (newSize == size) {
 		newSize++; // guarantee at least one element increase;
 	}
+	return newSize;
+}
 
+// private function that moves the first size elements of the reference container to new storage of the specified capacity
+void RationalArray::copyToCapacity(Rational *&originalArray, std::size_t size, std::size_t newCapacity) {
 	// create the new array
-	Rational** newArray;
-	initArray(newArray, newSize);
+	Rational* newArray;
+	initArray(newArray, newCapacity);
 
-	// copy
-	for (unsigned int i = 0; i < size; i++) {
-		*newArray[i] = *originalArray[i];
+	// move -- this cannot throw, so the elements are never split between the two buffers
+	for (std::size_t i = 0; i < size; i++) {
+		new (newArray + i) Rational(std::move(originalArray[i]));
 	}
 
 	// free old resources
-	freeArray(originalArray);
+	freeArray(originalArray, size);
 
 	// copy reference
 	originalArray = newArray;
-
-	return newSize;
 }
 
-// function that initializes an array reference to a specified size
-void RationalArray::initArray(Rational**& arrayRef, std::size_t size) {
+// function that allocates uninitialized storage for a specified number of elements -- elements are constructed as they are added
+void RationalArray::initArray(Rational*& arrayRef, std::size_t size) {
+	arrayRef = nullptr;
 	try {
-		// allocate memory for pointer array
-		arrayRef = new Rational*[size];
-		// allocate memory for each element
-		for (unsigned int i = 0; i < size; i++) {
-			arrayRef[i] = new Rational();
-		}
+		// one allocation for every slot
+		arrayRef = static_cast<Rational*>(::operator new(size * sizeof(Rational)));
 	}
 	catch (std::bad_alloc &ex) {
 		// call the resource handler for this class
@@ -223,18 +436,28 @@ void RationalArray::initArray(Rational**& arrayRef, std::size_t size) {
 	}
 }
 
-// free the specified array reference
-void RationalArray::freeArray(Rational**& arrayRef) {
-	delete[] arrayRef;
+// destroy the first size elements of the specified array reference, and free its storage
+void RationalArray::freeArray(Rational*& arrayRef, std::size_t size) {
+	std::destroy(arrayRef, arrayRef + size);
+	// inline storage is part of the derived object, and is not freed
+	if (arrayRef != inlineStorage) {
+		::operator delete(arrayRef);
+	}
+	arrayRef = nullptr;
+}
+
+// true if the elements are in the inline storage of a derived class
+bool RationalArray::usesInlineStorage() const {
+	return rationalArray != nullptr && rationalArray == inlineStorage;
 }
 
 // handler used if bad_alloc is thrown
 // this will free all resources, print to std::cerr and terminate.
-void RationalArray::badAllocHandler(const char* reason, Rational**& arrayRef) {
+void RationalArray::badAllocHandler(const char* reason, Rational*& arrayRef) {
 	// tell the user what happened
 	std::cerr << "Unable to allocate memory.\nReason = " << reason << "\nFreeing resources and terminating program" << std::endl;
-	// free resources
-	freeArray(arrayRef);
+	// free resources -- the failed allocation holds no elements
+	freeArray(arrayRef, 0);
 
 	// terminate program
 	std::terminate();
@@ -4,15 +4,20 @@
 * Email: johnsonrw82@csu.fullerton.edu
 *
 * This header provides an interface for a RationalArray, a container of Rational number objects
-* This class uses a fixed-size native array to provide storage for Rational objects
-* The class provides basic container operations, and should eventually update to allow dynamic memory allocation and re-sizing
+* The elements are stored by value in one contiguous buffer, which grows as elements are added
+* The class provides basic container operations
 */
 
 #ifndef RATIONAL_ARRAY_H
 #define RATIONAL_ARRAY_H
 
+#include <cstddef>
 #include <exception>
+#include <functional>
+#include <ostream>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "Rational.h"
 #include "RationalException.h"
@@ -26,17 +31,31 @@ using namespace rational;
 // class definition
 class RationalArray {
 public:
+	// standard container types -- the elements are contiguous, so the iterators are pointers
+	typedef Rational value_type;
+	typedef std::size_t size_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef Rational& reference;
+	typedef const Rational& const_reference;
+	typedef Rational* iterator;
+	typedef const Rational* const_iterator;
+
 	// constructor/destructor
 	RationalArray();
 	// construct with an initial size
 	RationalArray(int initialSize);
 	// copy constructor
 	RationalArray(const RationalArray& ra);
+	// move constructor -- takes the storage of ra, which is left empty with no capacity
+	// (elements in the inline storage of a RationalSmallArray are moved one by one instead)
+	RationalArray(RationalArray&& ra) noexcept;
 	// destructor
 	virtual ~RationalArray();
 
 	// assignment operator
 	RationalArray& operator=(const RationalArray& ra);
+	// move assignment operator -- as the move constructor, freeing the elements of this array
+	RationalArray& operator=(RationalArray&& ra) noexcept;
 
 	// equality operators
 	bool operator==(const RationalArray& ra) const;
@@ -46,10 +65,31 @@ public:
 	Rational retrieve(int index) const;
 	//Rational* retrieve(int index) const;
 
+	// unchecked access -- the index must be less than size(). Elements are reached in place, without a copy
+	// an element changed through a reference must stay a valid rational in lowest terms -- its denominator must not be set
+	// to 0, and it must not be left unreduced (the Rational setters reduce; writing through a Fraction reference does not)
+	Rational& operator[](std::size_t index);
+	const Rational& operator[](std::size_t index) const;
+	// the elements, as size() contiguous Rationals -- together with size() this is a span of the array
+	// pointers, references and iterators are invalidated when the array grows, and by clear
+	Rational* data();
+	const Rational* data() const;
+
+	// iterators, for range-for and the standard algorithms
+	iterator begin();
+	iterator end();
+	const_iterator begin() const;
+	const_iterator end() const;
+	const_iterator cbegin() const;
+	const_iterator cend() const;
+
 	// add an object
 	void add(const Rational& rationalObj);
 	// add by pointer
 	void add(Rational* rationalPtr);
+	// construct an element from a numerator and denominator in place at the end of the container, and return it
+	// throws DivideByZeroException for a zero denominator, leaving the container unchanged
+	Rational& emplace_back(const int numerator, const int denominator = 1);
 
 	// replace an object
 	void replace(int index, const Rational& rationalObj);
@@ -63,31 +103,122 @@ public:
 	// capacity of the container
 	std::size_t capacity() const;
 
-	// clear container
+	// clear container -- the capacity is kept, so the container can be refilled without allocating
 	void clear();
-
-	// print the contents
+	// grow the capacity to at least newCapacity, so that many elements can be added without resizing
+	void reserve(std::size_t newCapacity);
+	// change the number of elements -- elements past newSize are removed, and new elements are 0. Growing past the capacity
+	// grows it by half again (or to newSize, if that is larger), as add does, where reserve grows it exactly
+	void resize(std::size_t newSize);
+	// reduce the capacity to the number of elements -- or return them to the inline storage, if they fit
+	void shrink_to_fit();
+
+	// batch operations
+	// raise every element to the specified power -- if any element overflows, the container is left unchanged
+	void pow(const int exponent);
+	// replace every element with the closest rational whose denominator does not exceed maxDenominator
+	// throws InvalidArgumentException if maxDenominator is not positive
+	void limitDenominator(const int maxDenominator);
+	// add the best rational approximation of each double, with denominators no larger than maxDenominator
+	// if any value cannot be approximated, nothing is added
+	void addApproximations(const std::vector<double>& values, const int maxDenominator);
+
+	// print the contents to std::cout, one element per line, in the format set on std::cout (as operator<< does)
 	void printArray() const;
 
+	// output
+	// the destination of writeTo -- called with each block of formatted text
+	typedef std::function<void(const char* data, std::size_t size)> Sink;
+	// write the elements to the sink, in the specified format, with separator between them
+	// the elements are formatted into one reusable buffer, and the sink is called once per full buffer
+	void writeTo(const Sink& sink, const Rational::RationalPrintType type = Rational::FRACTION, const std::string& separator = "\n") const;
+	// write the elements to an output stream -- the stream is not flushed. Without a type, the format set on the stream is
+	// used (as operator<< does), and a one-shot usedecimal/usefraction applies to the whole array
+	void writeTo(std::ostream& os, const std::string& separator = "\n") const;
+	void writeTo(std::ostream& os, const Rational::RationalPrintType type, const std::string& separator = "\n") const;
+	// write the elements to a file descriptor -- throws InvalidArgumentException if the descriptor cannot be written
+	void writeTo(int fileDescriptor, const Rational::RationalPrintType type = Rational::FRACTION, const std::string& separator = "\n") const;
+
 private:
-	// underlying storage
-	Rational** rationalArray;
+	// the size of the writeTo buffer
+	static constexpr std::size_t WRITE_BUFFER_SIZE = 64 * 1024;
+
+	// underlying storage -- maxCapacity slots, of which the first count hold constructed elements
+	Rational* rationalArray;
 	// item count
-	unsigned int count;
+	std::size_t count;
 	// max capacity
-	unsigned int maxCapacity;
-
-	// resize and copy the original array contents to a new, bigger array. return the new size
-	std::size_t resizeAndCopy(Rational **& originalArray, std::size_t size);
-	// init array resources
-	void initArray(Rational**& arrayRef, std::size_t size);
-	// free array resources
-	void freeArray(Rational**& arrayRef);
+	std::size_t maxCapacity;
+
+	// resize and move the original array contents to a new, bigger array. return the new size
+	std::size_t resizeAndCopy(Rational *& originalArray, std::size_t size);
+	// the capacity to grow a full array of the specified size to -- half as large again, and at least one larger
+	static std::size_t growCapacity(std::size_t size);
+	// move the original array contents to a new array of the specified capacity
+	void copyToCapacity(Rational *& originalArray, std::size_t size, std::size_t newCapacity);
+	// init array resources -- allocates the storage, without constructing any elements
+	void initArray(Rational*& arrayRef, std::size_t size);
+	// free array resources -- destroys the first size elements
+	void freeArray(Rational*& arrayRef, std::size_t size);
 
 	// handler used for when bad_alloc is thrown
-	void badAllocHandler(const char* reason, Rational**& arrayRef);
+	void badAllocHandler(const char* reason, Rational*& arrayRef);
+	// true if the elements are in the inline storage
+	bool usesInlineStorage() const;
+
+protected:
+	// construct an empty array whose first inlineCapacity elements are stored in inlineStorage, which the derived class
+	// owns (see RationalSmallArray). The elements move to the heap if the array outgrows it
+	RationalArray(Rational* inlineStorage, std::size_t inlineCapacity);
+
+private:
+	// the inline storage provided by a derived class, or nullptr
+	Rational* inlineStorage;
+	// the capacity of the inline storage
+	std::size_t inlineCapacity;
 };
 
+// inline members -- these are on the path of every element access
+inline Rational& RationalArray::operator[](std::size_t index) {
+	return rationalArray[index];
+}
+
+inline const Rational& RationalArray::operator[](std::size_t index) const {
+	return rationalArray[index];
+}
+
+inline Rational* RationalArray::data() {
+	return rationalArray;
+}
+
+inline const Rational* RationalArray::data() const {
+	return rationalArray;
+}
+
+inline RationalArray::iterator RationalArray::begin() {
+	return rationalArray;
+}
+
+inline RationalArray::iterator RationalArray::end() {
+	return rationalArray + count;
+}
+
+inline RationalArray::const_iterator RationalArray::begin() const {
+	return rationalArray;
+}
+
+inline RationalArray::const_iterator RationalArray::end() const {
+	return rationalArray + count;
+}
+
+inline RationalArray::const_iterator RationalArray::cbegin() const {
+	return begin();
+}
+
+inline RationalArray::const_iterator RationalArray::cend() const {
+	return end();
+}
+
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+/**
+* File: RationalArrayFile.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Implementation of the rational array file writer and the memory mapped view.
+*/
+
+#include "RationalArrayFile.h"
+#include "ArrayIndexOutOfBoundsException.h"
+#include "DivideByZeroException.h"
+#include "InvalidArgumentException.h"
+#include "InvalidFormatException.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+using namespace rational::exception;
+
+namespace rational {
+	// the records follow the header directly, so the header keeps them aligned
+	static_assert(sizeof(RationalRecord) == 8, "records are two 32-bit integers");
+	static_assert(sizeof(RationalArrayFileHeader) == 16 && offsetof(RationalArrayFileHeader, count) == 8, "the header is 16 bytes");
+	static_assert(sizeof(int) == sizeof(std::int32_t), "Rational stores 32-bit integers");
+
+	// writer
+	// create the file, with a header that has no records yet
+	RationalArrayFileWriter::RationalArrayFileWriter(const std::string& fileName) : fileName(fileName), file(fileName, std::ios::binary | std::ios::trunc), count(0) {
+		if (!file) {
+			throw InvalidArgumentException("Unable to create file", fileName, __FILE__, __LINE__);
+		}
+
+		RationalArrayFileHeader header = {};
+		std::copy(MAGIC, MAGIC + sizeof(MAGIC), header.magic);
+		header.version = FORMAT_VERSION;
+		header.recordSize = sizeof(RationalRecord);
+		// the header goes out straight away, so the file is a valid empty array until it is closed
+		file.write((const char*)&header, sizeof(header));
+		file.flush();
+
+		buffer.reserve(BUFFER_RECORDS);
+	}
+
+	// close the file if the owner did not -- a destructor cannot report errors, so they are ignored
+	RationalArrayFileWriter::~RationalArrayFileWriter() {
+		if (file.is_open()) {
+			try {
+				close();
+			}
+			catch (std::exception&) {
+			}
+		}
+	}
+
+	// append one element
+	void RationalArrayFileWriter::append(const Rational& rationalObj) {
+		if (!file.is_open()) {
+			throw InvalidArgumentException("Unable to append to closed file", fileName, __FILE__, __LINE__);
+		}
+		// invalid rational
+		if (rationalObj.getDenominator() == 0) {
+			throw DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		// the rational is kept in lowest terms, so it is written as it is
+		buffer.push_back(RationalRecord{ rationalObj.getNumerator(), rationalObj.getDenominator() });
+		count++;
+		if (buffer.size() == BUFFER_RECORDS) {
+			flushBuffer();
+		}
+	}
+
+	// append every element of the array
+	void RationalArrayFileWriter::append(const RationalArray& rationals) {
+		for (const Rational& rationalObj : rationals) {
+			append(rationalObj);
+		}
+	}
+
+	// the number of elements appended
+	std::size_t RationalArrayFileWriter::size() const {
+		return (std::size_t)count;
+	}
+
+	// write the rest of the records, then the count
+	void RationalArrayFileWriter::close() {
+		if (!file.is_open()) {
+			throw InvalidArgumentException("Unable to close file that is already closed", fileName, __FILE__, __LINE__);
+		}
+
+		flushBuffer();
+		file.seekp(offsetof(RationalArrayFileHeader, count));
+		file.write((const char*)&count, sizeof(count));
+		file.close();
+		if (file.fail()) {
+			throw InvalidArgumentException("Unable to write file", fileName, __FILE__, __LINE__);
+		}
+	}
+
+	// write the buffered records
+	void RationalArrayFileWriter::flushBuffer() {
+		file.write((const char*)buffer.data(), buffer.size() * sizeof(RationalRecord));
+		buffer.clear();
+	}
+
+	// view
+	// map the file and check the header -- the records are used in place
+	MappedRationalArray::MappedRationalArray(const std::string& fileName) : file(fileName), records(nullptr), count(0) {
+		RationalArrayFileHeader header;
+		if (file.size() < sizeof(header)) {
+			throw InvalidFormatException("Rational array file is too short: " + fileName, __FILE__, __LINE__);
+		}
+		std::memcpy(&header, file.data(), sizeof(header));
+
+		if (std::memcmp(header.magic, RationalArrayFileWriter::MAGIC, sizeof(header.magic)) != 0) {
+			throw InvalidFormatException("Not a rational array file: " + fileName, __FILE__, __LINE__);
+		}
+		if (header.version == 0 || header.version > RationalArrayFileWriter::FORMAT_VERSION || header.recordSize != sizeof(RationalRecord)) {
+			throw InvalidFormatException("Unsupported rational array file version: " + fileName, __FILE__, __LINE__);
+		}
+		if (header.count > (file.size() - sizeof(header)) / sizeof(RationalRecord)) {
+			throw InvalidFormatException("Rational array file is shorter than its header says: " + fileName, __FILE__, __LINE__);
+		}
+
+		// the mapping is page aligned, and the header is a whole number of records long
+		records = (const RationalRecord*)(file.data() + sizeof(header));
+		count = (std::size_t)header.count;
+	}
+
+	// retrieve an element
+	Rational MappedRationalArray::retrieve(int index) const {
+		if (index >= 0 && (std::size_t)index < count) {
+			return toRational(records[index]);
+		}
+		else {
+			throw ArrayIndexOutOfBoundsException(index, __FILE__, __LINE__);
+		}
+	}
+
+	// copy every element
+	void MappedRationalArray::copyTo(RationalArray& rationals) const {
+		rationals.reserve(rationals.size() + count);
+		for (std::size_t i = 0; i < count; i++) {
+			rationals.add(toRational(records[i]));
+		}
+	}
+}
@@ -0,0 +1,187 @@
+/**
+* File: RationalArrayFile.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header provides an on-disk format for arrays of Rationals that can be opened without parsing or copying.
+* The file is a 16 byte header -- the magic "RATM", a version byte, the record size, two reserved bytes and the
+* 64-bit record count -- followed by fixed-width records of a 32-bit numerator and denominator, in the native
+* (little-endian) byte order. RationalArrayFileWriter produces the file with a streaming append API;
+* MappedRationalArray maps it read-only and reads elements straight from the mapped records, so opening a file costs
+* the same however large it is, and no element is allocated.
+* The count is only written when the writer is closed, so a file whose writer did not finish opens as empty.
+*/
+
+#ifndef RATIONAL_ARRAY_FILE_H
+#define RATIONAL_ARRAY_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "Rational.h"
+#include "RationalArray.h"
+#include "MemoryMappedFile.h"
+
+namespace rational {
+	// one element of the file
+	struct RationalRecord {
+		std::int32_t numerator;
+		std::int32_t denominator;
+	};
+
+	// the file header
+	struct RationalArrayFileHeader {
+		// "RATM"
+		char magic[4];
+		// the format version
+		std::uint8_t version;
+		// the size of a record, in bytes
+		std::uint8_t recordSize;
+		// unused -- zero
+		std::uint16_t reserved;
+		// the number of records
+		std::uint64_t count;
+	};
+
+	// writes a rational array file, one element (or array) at a time
+	class RationalArrayFileWriter {
+	public:
+		// the format version written by this class, and the newest MappedRationalArray reads
+		static constexpr std::uint8_t FORMAT_VERSION = 1;
+		// the bytes that start the file
+		static constexpr char MAGIC[4] = { 'R', 'A', 'T', 'M' };
+
+		// create (or truncate) the file -- throws InvalidArgumentException if it cannot be opened
+		explicit RationalArrayFileWriter(const std::string& fileName);
+		// close the file, if close was not called
+		~RationalArrayFileWriter();
+
+		// the file is owned by this object, so it cannot be copied
+		RationalArrayFileWriter(const RationalArrayFileWriter&) = delete;
+		RationalArrayFileWriter& operator=(const RationalArrayFileWriter&) = delete;
+
+		// append an element -- throws DivideByZeroException for an invalid rational
+		void append(const Rational& rationalObj);
+		// append every element of the array
+		void append(const RationalArray& rationals);
+		// the number of elements appended
+		std::size_t size() const;
+
+		// write the buffered records and the count, and close the file -- throws InvalidArgumentException if the file cannot be written
+		// or if the writer was already closed
+		void close();
+
+	private:
+		// the number of records buffered before they are written
+		static const std::size_t BUFFER_RECORDS = 4096;
+
+		// the file name, for error messages
+		std::string fileName;
+		// the file
+		std::ofstream file;
+		// records not yet written
+		std::vector<RationalRecord> buffer;
+		// the number of records appended
+		std::uint64_t count;
+
+		// write the buffered records to the file
+		void flushBuffer();
+	};
+
+	// a read-only view of a rational array file, mapped into memory
+	class MappedRationalArray {
+	public:
+		// iterator over the elements -- elements are read from their records, so they are returned by value
+		class const_iterator {
+		public:
+			typedef std::random_access_iterator_tag iterator_category;
+			typedef Rational value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const Rational* pointer;
+			typedef Rational reference;
+
+			const_iterator() : record(nullptr) {}
+			explicit const_iterator(const RationalRecord* record) : record(record) {}
+
+			Rational operator*() const { return toRational(*record); }
+			Rational operator[](const difference_type offset) const { return toRational(record[offset]); }
+			const_iterator& operator++() { ++record; return *this; }
+			const_iterator operator++(int) { const_iterator previous(*this); ++record; return previous; }
+			const_iterator& operator--() { --record; return *this; }
+			const_iterator operator--(int) { const_iterator previous(*this); --record; return previous; }
+			const_iterator& operator+=(const difference_type offset) { record += offset; return *this; }
+			const_iterator& operator-=(const difference_type offset) { record -= offset; return *this; }
+			friend const_iterator operator+(const_iterator it, const difference_type offset) { return it += offset; }
+			friend const_iterator operator+(const difference_type offset, const_iterator it) { return it += offset; }
+			friend const_iterator operator-(const_iterator it, const difference_type offset) { return it -= offset; }
+			friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) { return lhs.record - rhs.record; }
+			friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) { return lhs.record == rhs.record; }
+			friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.record != rhs.record; }
+			friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) { return lhs.record < rhs.record; }
+			friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) { return lhs.record > rhs.record; }
+			friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.record <= rhs.record; }
+			friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) { return lhs.record >= rhs.record; }
+
+		private:
+			// the current record
+			const RationalRecord* record;
+		};
+
+		// map the file -- throws InvalidArgumentException if it cannot be opened or mapped,
+		// and InvalidFormatException if it is not a rational array file or is shorter than its header says
+		explicit MappedRationalArray(const std::string& fileName);
+
+		// retrieve an element -- throws ArrayIndexOutOfBoundsException if the index exceeds the bounds of the array,
+		// and DivideByZeroException if the record has a zero denominator
+		Rational retrieve(int index) const;
+		// the number of elements
+		std::size_t size() const;
+
+		// iterators
+		const_iterator begin() const;
+		const_iterator end() const;
+		// the mapped records
+		const RationalRecord* data() const;
+
+		// copy every element into a RationalArray
+		void copyTo(RationalArray& rationals) const;
+
+		// convert a record to a rational -- throws DivideByZeroException for a zero denominator
+		static Rational toRational(const RationalRecord& record);
+
+	private:
+		// the mapped file
+		MemoryMappedFile file;
+		// the records in the mapping
+		const RationalRecord* records;
+		// the number of records
+		std::size_t count;
+	};
+
+	// inline members -- these are on the path of every element access
+	inline Rational MappedRationalArray::toRational(const RationalRecord& record) {
+		return Rational(record.numerator, record.denominator);
+	}
+
+	inline std::size_t MappedRationalArray::size() const {
+		return count;
+	}
+
+	inline MappedRationalArray::const_iterator MappedRationalArray::begin() const {
+		return const_iterator(records);
+	}
+
+	inline MappedRationalArray::const_iterator MappedRationalArray::end() const {
+		return const_iterator(records + count);
+	}
+
+	inline const RationalRecord* MappedRationalArray::data() const {
+		return records;
+	}
+}
+
+#endif
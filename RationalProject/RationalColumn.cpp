@@ -0,0 +1,202 @@
+/**
+* File: RationalColumn.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Implementation of the structure-of-arrays rational container.
+*/
+
+#include "RationalColumn.h"
+#include "ArrayIndexOutOfBoundsException.h"
+#include "DivideByZeroException.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+using namespace rational::exception;
+
+namespace rational {
+	// the number of elements in one aligned block of a lane
+	static const std::size_t LANE_BLOCK = RationalColumn::LANE_ALIGNMENT / sizeof(int);
+
+	// constructors
+	RationalColumn::RationalColumn() : numeratorLane(nullptr), denominatorLane(nullptr), count(0), maxCapacity(0) {}
+
+	// copy the elements of the array -- they are already in lowest terms, so they are stored as they are
+	RationalColumn::RationalColumn(const RationalArray& rationals) : RationalColumn() {
+		reserve(rationals.size());
+		for (std::size_t i = 0; i < rationals.size(); i++) {
+			numeratorLane[i] = rationals[i].getNumerator();
+			denominatorLane[i] = rationals[i].getDenominator();
+		}
+		count = rationals.size();
+	}
+
+	RationalColumn::RationalColumn(const RationalColumn& column) : RationalColumn() {
+		reserve(column.count);
+		std::copy(column.numeratorLane, column.numeratorLane + column.count, numeratorLane);
+		std::copy(column.denominatorLane, column.denominatorLane + column.count, denominatorLane);
+		count = column.count;
+	}
+
+	RationalColumn::RationalColumn(RationalColumn&& column) noexcept
+		: numeratorLane(column.numeratorLane), denominatorLane(column.denominatorLane), count(column.count), maxCapacity(column.maxCapacity) {
+		column.numeratorLane = nullptr;
+		column.denominatorLane = nullptr;
+		column.count = 0;
+		column.maxCapacity = 0;
+	}
+
+	// destructor
+	RationalColumn::~RationalColumn() {
+		freeLanes();
+	}
+
+	// assignment operators
+	RationalColumn& RationalColumn::operator=(const RationalColumn& column) {
+		RationalColumn tmp(column); // make a copy
+		*this = std::move(tmp);
+		return *this;
+	}
+
+	RationalColumn& RationalColumn::operator=(RationalColumn&& column) noexcept {
+		std::swap(numeratorLane, column.numeratorLane);
+		std::swap(denominatorLane, column.denominatorLane);
+		std::swap(count, column.count);
+		std::swap(maxCapacity, column.maxCapacity);
+		return *this;
+	}
+
+	// test for equality -- the elements are in lowest terms, so equal elements have equal lanes
+	bool RationalColumn::operator==(const RationalColumn& column) const {
+		return count == column.count
+			&& std::equal(numeratorLane, numeratorLane + count, column.numeratorLane)
+			&& std::equal(denominatorLane, denominatorLane + count, column.denominatorLane);
+	}
+
+	// test for inequality
+	bool RationalColumn::operator!=(const RationalColumn& column) const {
+		return !(*this == column);
+	}
+
+	// retrieve an element
+	Rational RationalColumn::retrieve(int index) const {
+		if (index >= 0 && (std::size_t)index < count) {
+			return Rational(numeratorLane[index], denominatorLane[index]);
+		}
+		else {
+			throw ArrayIndexOutOfBoundsException(index, __FILE__, __LINE__);
+		}
+	}
+
+	// add an element to the end of the lanes, growing them by half when they are full
+	void RationalColumn::add(const Rational& rationalObj) {
+		// invalid rational
+		if (rationalObj.getDenominator() == 0) {
+			throw DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		if (count == maxCapacity) {
+			reallocate(std::max(LANE_BLOCK, maxCapacity + maxCapacity / 2));
+		}
+		numeratorLane[count] = rationalObj.getNumerator();
+		denominatorLane[count] = rationalObj.getDenominator();
+		count++;
+	}
+
+	// replace an element
+	void RationalColumn::replace(int index, const Rational& rationalObj) {
+		if (index < 0 || (std::size_t)index >= count) {
+			throw ArrayIndexOutOfBoundsException(index, __FILE__, __LINE__);
+		}
+		// invalid rational
+		if (rationalObj.getDenominator() == 0) {
+			throw DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		numeratorLane[index] = rationalObj.getNumerator();
+		denominatorLane[index] = rationalObj.getDenominator();
+	}
+
+	// remove an element, shifting the rest of each lane down
+	Rational RationalColumn::remove(int index) {
+		Rational removeElement = retrieve(index);
+		std::copy(numeratorLane + index + 1, numeratorLane + count, numeratorLane + index);
+		std::copy(denominatorLane + index + 1, denominatorLane + count, denominatorLane + index);
+		count--;
+		return removeElement;
+	}
+
+	// remove every element -- the lanes are kept for reuse
+	void RationalColumn::clear() {
+		count = 0;
+	}
+
+	// grow the capacity
+	void RationalColumn::reserve(std::size_t newCapacity) {
+		if (newCapacity > maxCapacity) {
+			reallocate(newCapacity);
+		}
+	}
+
+	// append every element to the array
+	void RationalColumn::copyTo(RationalArray& rationals) const {
+		rationals.reserve(rationals.size() + count);
+		for (std::size_t i = 0; i < count; i++) {
+			rationals.add(Rational(numeratorLane[i], denominatorLane[i]));
+		}
+	}
+
+	// convert every element -- one division per element, with no dependence between them
+	void RationalColumn::toDoubles(double* out) const {
+		const int* numerators = numeratorLane;
+		const int* denominators = denominatorLane;
+		for (std::size_t i = 0; i < count; i++) {
+			out[i] = (double)numerators[i] / (double)denominators[i];
+		}
+	}
+
+	// count the elements less than value -- n/d < a/b exactly when n*b < a*d, as the denominators are positive,
+	// and the products of two ints always fit in 64 bits
+	std::size_t RationalColumn::countLessThan(const Rational& value) const {
+		// invalid rational
+		if (value.getDenominator() == 0) {
+			throw DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		const std::int64_t a = value.getNumerator();
+		const std::int64_t b = value.getDenominator();
+		const int* numerators = numeratorLane;
+		const int* denominators = denominatorLane;
+		std::size_t result = 0;
+		for (std::size_t i = 0; i < count; i++) {
+			result += (std::int64_t)numerators[i] * b < a * (std::int64_t)denominators[i];
+		}
+		return result;
+	}
+
+	// allocate both lanes in one aligned block, and copy the elements into it
+	void RationalColumn::reallocate(std::size_t newCapacity) {
+		// round up to whole blocks, so the denominator lane starts aligned
+		newCapacity = (newCapacity + LANE_BLOCK - 1) / LANE_BLOCK * LANE_BLOCK;
+		int* newLanes = static_cast<int*>(::operator new(2 * newCapacity * sizeof(int), std::align_val_t(LANE_ALIGNMENT)));
+		std::copy(numeratorLane, numeratorLane + count, newLanes);
+		std::copy(denominatorLane, denominatorLane + count, newLanes + newCapacity);
+
+		freeLanes();
+		numeratorLane = newLanes;
+		denominatorLane = newLanes + newCapacity;
+		maxCapacity = newCapacity;
+	}
+
+	// free the storage
+	void RationalColumn::freeLanes() {
+		if (numeratorLane != nullptr) {
+			::operator delete(numeratorLane, std::align_val_t(LANE_ALIGNMENT));
+		}
+		numeratorLane = nullptr;
+		denominatorLane = nullptr;
+	}
+}
@@ -0,0 +1,110 @@
+/**
+* File: RationalColumn.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header provides RationalColumn, a container of Rationals stored as two separate lanes -- every numerator, then every
+* denominator -- instead of one array of numerator/denominator pairs. Each lane is contiguous and aligned to LANE_ALIGNMENT
+* bytes, so bulk kernels load a full vector register of numerators (or denominators) at a time; the kernels below are plain
+* loops written so the compiler can vectorize them. The elements are kept in lowest terms with positive denominators, as
+* Rationals are. The container operations match RationalArray's, and a column converts to and from a RationalArray.
+*/
+
+#ifndef RATIONAL_COLUMN_H
+#define RATIONAL_COLUMN_H
+
+#include <cstddef>
+
+#include "Rational.h"
+#include "RationalArray.h"
+
+namespace rational {
+	// a structure-of-arrays container of Rationals
+	class RationalColumn {
+	public:
+		// the alignment of each lane, in bytes -- a full AVX2 register
+		static constexpr std::size_t LANE_ALIGNMENT = 32;
+
+		// construct an empty column -- nothing is allocated until the first add
+		RationalColumn();
+		// construct a column holding the elements of the array
+		explicit RationalColumn(const RationalArray& rationals);
+		// copy/move constructors
+		RationalColumn(const RationalColumn& column);
+		RationalColumn(RationalColumn&& column) noexcept;
+		// destructor
+		~RationalColumn();
+
+		// assignment operators
+		RationalColumn& operator=(const RationalColumn& column);
+		RationalColumn& operator=(RationalColumn&& column) noexcept;
+
+		// equality operators -- columns are equal if they hold the same elements
+		bool operator==(const RationalColumn& column) const;
+		bool operator!=(const RationalColumn& column) const;
+
+		// retrieve an element -- throws ArrayIndexOutOfBoundsException if the index exceeds the bounds of the column
+		Rational retrieve(int index) const;
+		// add an element -- throws DivideByZeroException for an invalid rational
+		void add(const Rational& rationalObj);
+		// replace an element -- throws as retrieve and add
+		void replace(int index, const Rational& rationalObj);
+		// remove an element and return it -- throws as retrieve
+		Rational remove(int index);
+		// size of the container
+		std::size_t size() const;
+		// capacity of the container
+		std::size_t capacity() const;
+
+		// remove every element, keeping the capacity
+		void clear();
+		// grow the capacity to at least newCapacity
+		void reserve(std::size_t newCapacity);
+
+		// the lanes -- size() numerators and size() denominators, each aligned to LANE_ALIGNMENT
+		const int* numerators() const;
+		const int* denominators() const;
+
+		// append every element to the array
+		void copyTo(RationalArray& rationals) const;
+
+		// kernels
+		// write the value of every element as a double to out, which must have room for size() values
+		void toDoubles(double* out) const;
+		// the number of elements less than value -- throws DivideByZeroException for an invalid rational
+		std::size_t countLessThan(const Rational& value) const;
+
+	private:
+		// the numerator lane, followed in the same allocation by the denominator lane
+		int* numeratorLane;
+		int* denominatorLane;
+		// item count
+		std::size_t count;
+		// max capacity -- a multiple of the lane alignment, so the denominator lane is aligned too
+		std::size_t maxCapacity;
+
+		// move the elements to storage with room for newCapacity elements
+		void reallocate(std::size_t newCapacity);
+		// free the storage
+		void freeLanes();
+	};
+
+	// inline members -- these are on the path of every element access
+	inline std::size_t RationalColumn::size() const {
+		return count;
+	}
+
+	inline std::size_t RationalColumn::capacity() const {
+		return maxCapacity;
+	}
+
+	inline const int* RationalColumn::numerators() const {
+		return numeratorLane;
+	}
+
+	inline const int* RationalColumn::denominators() const {
+		return denominatorLane;
+	}
+}
+
+#endif
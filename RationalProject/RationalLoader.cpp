@@ -0,0 +1,108 @@
+/**
+* File: RationalLoader.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Implementation of the bulk loader for text files of rationals.
+*/
+
+#include "RationalLoader.h"
+#include "MemoryMappedFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+namespace rational {
+	// map the file, and load its contents
+	std::size_t RationalLoader::loadFile(const std::string& fileName, RationalArray& rationals, std::vector<RationalParseError>& errors, unsigned int threadCount) {
+		MemoryMappedFile file(fileName);
+		return load(file.data(), file.data() + file.size(), rationals, errors, threadCount);
+	}
+
+	// split the text into newline-aligned chunks, parse them in parallel, then store the results in order
+	std::size_t RationalLoader::load(const char* first, const char* last, RationalArray& rationals, std::vector<RationalParseError>& errors, unsigned int threadCount) {
+		std::size_t length = last - first;
+		if (threadCount == 0) {
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+		}
+		std::size_t chunkCount = std::max<std::size_t>(1, std::min<std::size_t>(threadCount, length / MIN_CHUNK_SIZE));
+
+		// each chunk ends just after a newline (or at the end of the text), so no line is split
+		std::vector<Chunk> chunks(chunkCount);
+		const char* chunkFirst = first;
+		for (std::size_t i = 0; i < chunkCount; i++) {
+			const char* chunkLast = last;
+			if (i + 1 < chunkCount) {
+				chunkLast = std::max(chunkFirst, first + length / chunkCount * (i + 1));
+				const char* newline = (const char*)std::memchr(chunkLast, '\n', last - chunkLast);
+				chunkLast = (newline == nullptr) ? last : newline + 1;
+			}
+			chunks[i].first = chunkFirst;
+			chunks[i].last = chunkLast;
+			chunkFirst = chunkLast;
+		}
+
+		// the first chunk is parsed on this thread
+		std::vector<std::thread> threads;
+		for (std::size_t i = 1; i < chunkCount; i++) {
+			threads.emplace_back(parseChunk, std::ref(chunks[i]));
+		}
+		parseChunk(chunks[0]);
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+
+		// make room for every result at once
+		std::size_t loaded = 0;
+		for (const Chunk& chunk : chunks) {
+			loaded += chunk.rationals.size();
+		}
+		rationals.reserve(rationals.size() + loaded);
+
+		// store the results, numbering the errors from the start of the text
+		std::size_t lineOffset = 0;
+		for (Chunk& chunk : chunks) {
+			for (const Rational& rationalObj : chunk.rationals) {
+				rationals.add(rationalObj);
+			}
+			for (RationalParseError& error : chunk.errors) {
+				error.lineNumber += lineOffset;
+				errors.push_back(error);
+			}
+			lineOffset += chunk.lineCount;
+		}
+
+		return loaded;
+	}
+
+	// parse each line of the chunk with the non-throwing parser
+	void RationalLoader::parseChunk(Chunk& chunk) {
+		chunk.lineCount = 0;
+		// roughly one rational per ten characters
+		chunk.rationals.reserve((chunk.last - chunk.first) / 10);
+
+		Rational value;
+		const char* lineFirst = chunk.first;
+		while (lineFirst != chunk.last) {
+			const char* newline = (const char*)std::memchr(lineFirst, '\n', chunk.last - lineFirst);
+			const char* lineLast = (newline == nullptr) ? chunk.last : newline;
+			chunk.lineCount++;
+
+			// Windows line endings
+			const char* textLast = (lineLast != lineFirst && lineLast[-1] == '\r') ? lineLast - 1 : lineLast;
+			if (textLast != lineFirst) {
+				ArithmeticStatus status = Rational::tryParse(lineFirst, textLast, value);
+				if (status == STATUS_OK) {
+					chunk.rationals.push_back(value);
+				}
+				else {
+					chunk.errors.push_back(RationalParseError{ chunk.lineCount, status, std::string(lineFirst, textLast) });
+				}
+			}
+
+			lineFirst = (newline == nullptr) ? chunk.last : newline + 1;
+		}
+	}
+}
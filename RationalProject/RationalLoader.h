@@ -0,0 +1,63 @@
+/**
+* File: RationalLoader.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This class provides a bulk loader for text files of rationals, one per line, in the format accepted by Rational::read.
+* The file is memory mapped and split into newline-aligned chunks, which are parsed on separate threads with
+* Rational::tryParse; the results are then copied into a RationalArray sized for them up front.
+* Lines that fail to parse are reported individually, and do not stop the rest of the file from loading. Empty lines are skipped.
+*/
+
+#ifndef RATIONAL_LOADER_H
+#define RATIONAL_LOADER_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Rational.h"
+#include "RationalArray.h"
+
+namespace rational {
+	// a line that could not be parsed
+	struct RationalParseError {
+		// the line number, starting from 1
+		std::size_t lineNumber;
+		// why the line failed -- STATUS_INVALID_FORMAT, STATUS_DIVIDE_BY_ZERO or STATUS_OVERFLOW
+		ArithmeticStatus status;
+		// the text of the line
+		std::string text;
+	};
+
+	class RationalLoader {
+	public:
+		// load every line of the file into rationals, appending the lines that fail to errors, and return the number loaded
+		// threadCount 0 uses one thread per hardware thread. Throws InvalidArgumentException if the file cannot be opened
+		static std::size_t loadFile(const std::string& fileName, RationalArray& rationals, std::vector<RationalParseError>& errors, unsigned int threadCount = 0);
+		// load every line of the text in [first, last), as loadFile does
+		static std::size_t load(const char* first, const char* last, RationalArray& rationals, std::vector<RationalParseError>& errors, unsigned int threadCount = 0);
+
+	private:
+		// the smallest chunk worth a thread of its own
+		static const std::size_t MIN_CHUNK_SIZE = 64 * 1024;
+
+		// the results of parsing one chunk
+		struct Chunk {
+			// the first and one-past-the-last characters of the chunk
+			const char* first;
+			const char* last;
+			// the parsed rationals, in order
+			std::vector<Rational> rationals;
+			// the lines that failed, numbered from 1 within the chunk
+			std::vector<RationalParseError> errors;
+			// the number of lines in the chunk
+			std::size_t lineCount;
+		};
+
+		// parse every line of a chunk
+		static void parseChunk(Chunk& chunk);
+	};
+}
+
+#endif
@@ -0,0 +1,158 @@
+/**
+* File: RationalSerializer.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Implementation of the binary encoding of RationalArrays, and the stream helpers shared with single rationals.
+*/
+
+#include "RationalSerializer.h"
+#include "DivideByZeroException.h"
+#include "InvalidFormatException.h"
+#include "OverflowException.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+using namespace rational::exception;
+
+namespace rational {
+	// write the header, then the elements in blocks
+	void RationalSerializer::write(std::ostream& os, const RationalArray& rationals) {
+		typedef IntegerTraits<int>::unsigned_type UIntT;
+		const std::size_t count = rationals.size();
+
+		// a shared denominator is written once, instead of once per element
+		bool sharedDenominator = count > 0;
+		int denominator = (count > 0) ? rationals[0].getDenominator() : 1;
+		for (std::size_t i = 1; i < count && sharedDenominator; i++) {
+			sharedDenominator = rationals[i].getDenominator() == denominator;
+		}
+
+		char buffer[BLOCK_SIZE];
+		char* out = std::copy(MAGIC, MAGIC + sizeof(MAGIC), buffer);
+		*out++ = (char)FORMAT_VERSION;
+		*out++ = (char)(sharedDenominator ? SHARED_DENOMINATOR : 0);
+		out = encodeVarint<std::uint64_t>(out, count);
+		if (sharedDenominator) {
+			out = encodeVarint<UIntT>(out, (UIntT)denominator);
+		}
+
+		for (std::size_t i = 0; i < count; i++) {
+			// flush the block when the next element might not fit
+			if ((std::size_t)(buffer + BLOCK_SIZE - out) < maxEncodedSize<int>()) {
+				os.write(buffer, out - buffer);
+				out = buffer;
+			}
+
+			const Rational& rationalObj = rationals[i];
+			if (sharedDenominator) {
+				out = encodeVarint<UIntT>(out, zigzagEncode<int>(rationalObj.getNumerator()));
+			}
+			else {
+				out = encode(out, rationalObj);
+			}
+		}
+		os.write(buffer, out - buffer);
+	}
+
+	// read the header, then each element
+	std::size_t RationalSerializer::read(std::istream& is, RationalArray& rationals) {
+		typedef IntegerTraits<int>::unsigned_type UIntT;
+
+		// magic, version and flags
+		char header[sizeof(MAGIC) + 2];
+		if (!is.read(header, sizeof(header))) {
+			throw InvalidFormatException("Truncated binary rational array header", __FILE__, __LINE__);
+		}
+		if (std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0) {
+			is.setstate(std::ios_base::failbit);
+			throw InvalidFormatException("Not a binary rational array", __FILE__, __LINE__);
+		}
+		unsigned char version = (unsigned char)header[sizeof(MAGIC)];
+		unsigned char flags = (unsigned char)header[sizeof(MAGIC) + 1];
+		if (version == 0 || version > FORMAT_VERSION) {
+			is.setstate(std::ios_base::failbit);
+			throw InvalidFormatException("Unsupported binary rational array version " + std::to_string(version), __FILE__, __LINE__);
+		}
+		if ((flags & ~SHARED_DENOMINATOR) != 0) {
+			is.setstate(std::ios_base::failbit);
+			throw InvalidFormatException("Unknown binary rational array flags " + std::to_string(flags), __FILE__, __LINE__);
+		}
+
+		// element count, and the shared denominator
+		char buffer[maxEncodedSize<int>()];
+		const char* first = buffer;
+		std::uint64_t count = 0;
+		char* end = readVarintBytes(is, buffer, maxVarintSize<std::uint64_t>());
+		throwOnError(tryDecodeVarint<std::uint64_t>(first, end, count));
+
+		UIntT denominator = 0;
+		if (flags & SHARED_DENOMINATOR) {
+			first = buffer;
+			end = readVarintBytes(is, buffer, maxVarintSize<UIntT>());
+			throwOnError(tryDecodeVarint<UIntT>(first, end, denominator));
+			if (denominator == 0) {
+				throwOnError(STATUS_DIVIDE_BY_ZERO);
+			}
+			if (denominator > (UIntT)IntegerTraits<int>::max()) {
+				throwOnError(STATUS_OVERFLOW);
+			}
+		}
+
+		// the count is not trusted for more than a modest reservation, so a corrupt header cannot exhaust memory
+		const std::uint64_t MAX_RESERVE = 1 << 20;
+		rationals.reserve(rationals.size() + (std::size_t)std::min(count, MAX_RESERVE));
+
+		Rational rationalObj;
+		for (std::uint64_t i = 0; i < count; i++) {
+			if (flags & SHARED_DENOMINATOR) {
+				UIntT numerator = 0;
+				first = buffer;
+				end = readVarintBytes(is, buffer, maxVarintSize<UIntT>());
+				throwOnError(tryDecodeVarint<UIntT>(first, end, numerator));
+				throwOnError(Rational::tryCreate(zigzagDecode<int>(numerator), (int)denominator, rationalObj));
+			}
+			else {
+				read(is, rationalObj);
+			}
+			rationals.add(rationalObj);
+		}
+
+		return (std::size_t)count;
+	}
+
+	// copy one varint from the stream
+	char* RationalSerializer::readVarintBytes(std::istream& is, char* buffer, const std::size_t capacity) {
+		std::streambuf* streamBuffer = is.rdbuf();
+		for (std::size_t i = 0; i < capacity; i++) {
+			std::streambuf::int_type byte = (streamBuffer != nullptr) ? streamBuffer->sbumpc() : std::streambuf::traits_type::eof();
+			if (std::streambuf::traits_type::eq_int_type(byte, std::streambuf::traits_type::eof())) {
+				is.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+				throw InvalidFormatException("Truncated binary rational", __FILE__, __LINE__);
+			}
+			buffer[i] = std::streambuf::traits_type::to_char_type(byte);
+			if ((byte & 0x80) == 0) {
+				return buffer + i + 1;
+			}
+		}
+
+		// too long for the type -- this fails to decode
+		return buffer + capacity;
+	}
+
+	// throw the exception for a failed status
+	void RationalSerializer::throwOnError(const ArithmeticStatus status) {
+		switch (status) {
+		case STATUS_OK:
+			break;
+		case STATUS_DIVIDE_BY_ZERO:
+			throw DivideByZeroException(__FILE__, __LINE__);
+		case STATUS_OVERFLOW:
+			throw OverflowException(__FILE__, __LINE__);
+		default:
+			throw InvalidFormatException("Malformed binary rational", __FILE__, __LINE__);
+		}
+	}
+}
@@ -0,0 +1,200 @@
+/**
+* File: RationalSerializer.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This class provides a compact binary encoding for rationals and RationalArrays, as a faster and smaller alternative to text.
+* A rational is its numerator as a zigzag varint (so small negative values stay short) followed by its denominator as a varint;
+* a varint stores 7 bits per byte, low bits first, with the high bit set on every byte but the last.
+* An array is a header -- the magic "RATA", a version byte, a flags byte and the element count as a varint -- followed by its
+* elements. When every element has the same denominator, the SHARED_DENOMINATOR flag is set and the denominator is written
+* once after the count, followed by the numerators alone.
+* Every native instantiation of BasicRational can be encoded; BigRational has no fixed width, and is not supported.
+*/
+
+#ifndef RATIONAL_SERIALIZER_H
+#define RATIONAL_SERIALIZER_H
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include "Rational.h"
+#include "RationalArray.h"
+
+namespace rational {
+	class RationalSerializer {
+	public:
+		// the array format version written by this class, and the newest it reads
+		static constexpr unsigned char FORMAT_VERSION = 1;
+		// array flag -- every element has the denominator written after the count
+		static constexpr unsigned char SHARED_DENOMINATOR = 1;
+		// the bytes that start an encoded array
+		static constexpr char MAGIC[4] = { 'R', 'A', 'T', 'A' };
+
+		// the most bytes a varint of the unsigned type takes
+		template<typename UIntT>
+		static constexpr std::size_t maxVarintSize() {
+			return (sizeof(UIntT) * CHAR_BIT + 6) / 7;
+		}
+		// the most bytes an encoded rational of the integer type takes
+		template<typename IntT>
+		static constexpr std::size_t maxEncodedSize() {
+			return 2 * maxVarintSize<typename IntegerTraits<IntT>::unsigned_type>();
+		}
+
+		// map signed values to unsigned ones, so values near zero have short varints: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+		template<typename IntT>
+		static typename IntegerTraits<IntT>::unsigned_type zigzagEncode(const IntT value);
+		template<typename IntT>
+		static IntT zigzagDecode(const typename IntegerTraits<IntT>::unsigned_type value);
+
+		// write the varint of value at out, which must have room for maxVarintSize bytes, and return the end of it
+		template<typename UIntT>
+		static char* encodeVarint(char* out, UIntT value);
+		// read a varint from [first, last) and advance first past it. Returns STATUS_INVALID_FORMAT if the varint is truncated,
+		// or STATUS_OVERFLOW if it does not fit in the type; first and value are only written when the status is STATUS_OK
+		template<typename UIntT>
+		static ArithmeticStatus tryDecodeVarint(const char*& first, const char* last, UIntT& value);
+
+		// write the encoding of the rational at out, which must have room for maxEncodedSize bytes, and return the end of it
+		template<typename IntT, typename GcdPolicy>
+		static char* encode(char* out, const BasicRational<IntT, GcdPolicy>& rationalObj);
+		// read an encoded rational from [first, last) and advance first past it, without throwing -- as tryDecodeVarint, and
+		// STATUS_DIVIDE_BY_ZERO for a zero denominator. Values that are not in lowest terms are reduced
+		template<typename IntT, typename GcdPolicy>
+		static ArithmeticStatus tryDecode(const char*& first, const char* last, BasicRational<IntT, GcdPolicy>& result);
+
+		// stream operations -- these throw InvalidFormatException for truncated or malformed input,
+		// OverflowException for values too large for the integer type, and DivideByZeroException for a zero denominator
+		// write the encoding of the rational to the stream
+		template<typename IntT, typename GcdPolicy>
+		static void write(std::ostream& os, const BasicRational<IntT, GcdPolicy>& rationalObj);
+		// read an encoded rational from the stream -- no bytes past its end are consumed
+		template<typename IntT, typename GcdPolicy>
+		static void read(std::istream& is, BasicRational<IntT, GcdPolicy>& rationalObj);
+		// write the array, header first, in blocks
+		static void write(std::ostream& os, const RationalArray& rationals);
+		// read an encoded array from the stream, appending its elements to rationals, and return the number read
+		static std::size_t read(std::istream& is, RationalArray& rationals);
+
+	private:
+		// the block size used to write arrays
+		static const std::size_t BLOCK_SIZE = 4096;
+
+		// copy the bytes of one varint from the stream into buffer (at most capacity bytes), and return the end of them
+		// throws InvalidFormatException if the stream ends first
+		static char* readVarintBytes(std::istream& is, char* buffer, const std::size_t capacity);
+		// throw the exception for a failed status
+		static void throwOnError(const ArithmeticStatus status);
+	};
+
+	// zigzag mapping
+	template<typename IntT>
+	inline typename IntegerTraits<IntT>::unsigned_type RationalSerializer::zigzagEncode(const IntT value) {
+		typedef typename IntegerTraits<IntT>::unsigned_type UIntT;
+		// the sign moves to the low bit; negative values also have their other bits inverted
+		return (UIntT(value) << 1) ^ ((value < 0) ? ~UIntT(0) : UIntT(0));
+	}
+
+	template<typename IntT>
+	inline IntT RationalSerializer::zigzagDecode(const typename IntegerTraits<IntT>::unsigned_type value) {
+		typedef typename IntegerTraits<IntT>::unsigned_type UIntT;
+		return (IntT)((value >> 1) ^ (UIntT(0) - (value & 1)));
+	}
+
+	// varints
+	template<typename UIntT>
+	inline char* RationalSerializer::encodeVarint(char* out, UIntT value) {
+		while (value >= 0x80) {
+			*out++ = (char)((value & 0x7F) | 0x80);
+			value >>= 7;
+		}
+		*out++ = (char)value;
+		return out;
+	}
+
+	template<typename UIntT>
+	inline ArithmeticStatus RationalSerializer::tryDecodeVarint(const char*& first, const char* last, UIntT& value) {
+		const int bits = (int)(sizeof(UIntT) * CHAR_BIT);
+		UIntT decoded = 0;
+		int shift = 0;
+		for (const char* current = first; current != last; current++) {
+			UIntT payload = (unsigned char)*current & 0x7F;
+			// the payload must not have bits above the top of the type
+			if (shift >= bits || (shift > bits - 7 && (payload >> (bits - shift)) != 0)) {
+				return STATUS_OVERFLOW;
+			}
+			decoded |= payload << shift;
+			if (((unsigned char)*current & 0x80) == 0) {
+				first = current + 1;
+				value = decoded;
+				return STATUS_OK;
+			}
+			shift += 7;
+		}
+
+		// no final byte
+		return STATUS_INVALID_FORMAT;
+	}
+
+	// encode a rational -- it is in lowest terms with a positive denominator, so it is written as it is
+	template<typename IntT, typename GcdPolicy>
+	inline char* RationalSerializer::encode(char* out, const BasicRational<IntT, GcdPolicy>& rationalObj) {
+		static_assert(IntegerTraits<IntT>::is_native, "only fixed-width integer types can be encoded");
+		typedef typename IntegerTraits<IntT>::unsigned_type UIntT;
+		out = encodeVarint<UIntT>(out, zigzagEncode<IntT>(rationalObj.getNumerator()));
+		return encodeVarint<UIntT>(out, (UIntT)rationalObj.getDenominator());
+	}
+
+	// decode a rational
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus RationalSerializer::tryDecode(const char*& first, const char* last, BasicRational<IntT, GcdPolicy>& result) {
+		static_assert(IntegerTraits<IntT>::is_native, "only fixed-width integer types can be decoded");
+		typedef typename IntegerTraits<IntT>::unsigned_type UIntT;
+		const char* current = first;
+		UIntT numerator, denominator;
+		ArithmeticStatus status = tryDecodeVarint<UIntT>(current, last, numerator);
+		if (status == STATUS_OK) {
+			status = tryDecodeVarint<UIntT>(current, last, denominator);
+		}
+		if (status != STATUS_OK) {
+			return status;
+		}
+		if (denominator == 0) {
+			return STATUS_DIVIDE_BY_ZERO;
+		}
+		if (denominator > (UIntT)IntegerTraits<IntT>::max()) {
+			return STATUS_OVERFLOW;
+		}
+
+		status = BasicRational<IntT, GcdPolicy>::tryCreate(zigzagDecode<IntT>(numerator), (IntT)denominator, result);
+		if (status == STATUS_OK) {
+			first = current;
+		}
+		return status;
+	}
+
+	// write a rational to a stream
+	template<typename IntT, typename GcdPolicy>
+	inline void RationalSerializer::write(std::ostream& os, const BasicRational<IntT, GcdPolicy>& rationalObj) {
+		char buffer[maxEncodedSize<IntT>()];
+		os.write(buffer, encode(buffer, rationalObj) - buffer);
+	}
+
+	// read a rational from a stream, one varint at a time, so nothing after it is consumed
+	template<typename IntT, typename GcdPolicy>
+	inline void RationalSerializer::read(std::istream& is, BasicRational<IntT, GcdPolicy>& rationalObj) {
+		const std::size_t varintSize = maxVarintSize<typename IntegerTraits<IntT>::unsigned_type>();
+		char buffer[2 * varintSize];
+		char* end = readVarintBytes(is, buffer, varintSize);
+		end = readVarintBytes(is, end, varintSize);
+
+		const char* first = buffer;
+		throwOnError(tryDecode(first, (const char*)end, rationalObj));
+	}
+}
+
+#endif
@@ -0,0 +1,97 @@
+/**
+* File: RationalSmallArray.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header provides RationalSmallArray, a RationalArray with room for N elements inside the object itself. Up to N
+* elements are stored without any heap allocation, so a small array held by value costs nothing to create or destroy;
+* adding more than N moves the elements to the heap, as a RationalArray grows. It is a RationalArray, so it can be passed
+* wherever one is expected.
+*/
+
+#ifndef RATIONAL_SMALL_ARRAY_H
+#define RATIONAL_SMALL_ARRAY_H
+
+#include <cstddef>
+#include <utility>
+
+#include "Rational.h"
+#include "RationalArray.h"
+
+// a RationalArray with inline storage for N elements
+template<std::size_t N>
+class RationalSmallArray : public RationalArray {
+public:
+	static_assert(N > 0, "the inline capacity must be positive");
+
+	// construct an empty array, using the inline storage
+	RationalSmallArray();
+	// copy the elements of ra -- they are stored inline if they fit
+	RationalSmallArray(const RationalSmallArray& ra);
+	explicit RationalSmallArray(const RationalArray& ra);
+	// move the elements of ra -- heap storage is taken whole, inline elements are moved one by one
+	RationalSmallArray(RationalSmallArray&& ra) noexcept;
+	// destructor
+	~RationalSmallArray();
+
+	// assignment operators
+	RationalSmallArray& operator=(const RationalSmallArray& ra);
+	RationalSmallArray& operator=(RationalSmallArray&& ra) noexcept;
+
+private:
+	// the inline storage -- only the slots in use hold constructed elements
+	alignas(Rational) unsigned char buffer[N * sizeof(Rational)];
+
+	// replace the elements with copies of those of ra
+	void assign(const RationalArray& ra);
+};
+
+template<std::size_t N>
+inline RationalSmallArray<N>::RationalSmallArray() : RationalArray(reinterpret_cast<Rational*>(buffer), N) {}
+
+template<std::size_t N>
+inline RationalSmallArray<N>::RationalSmallArray(const RationalSmallArray& ra) : RationalSmallArray() {
+	assign(ra);
+}
+
+template<std::size_t N>
+inline RationalSmallArray<N>::RationalSmallArray(const RationalArray& ra) : RationalSmallArray() {
+	assign(ra);
+}
+
+template<std::size_t N>
+inline RationalSmallArray<N>::RationalSmallArray(RationalSmallArray&& ra) noexcept : RationalSmallArray() {
+	RationalArray::operator=(std::move(ra));
+}
+
+// the elements are destroyed here, while the inline storage is still part of the object
+template<std::size_t N>
+inline RationalSmallArray<N>::~RationalSmallArray() {
+	clear();
+}
+
+template<std::size_t N>
+inline RationalSmallArray<N>& RationalSmallArray<N>::operator=(const RationalSmallArray& ra) {
+	if (this != &ra) {
+		assign(ra);
+	}
+	return *this;
+}
+
+template<std::size_t N>
+inline RationalSmallArray<N>& RationalSmallArray<N>::operator=(RationalSmallArray&& ra) noexcept {
+	RationalArray::operator=(std::move(ra));
+	return *this;
+}
+
+// copy into the current storage, so elements that fit stay inline
+template<std::size_t N>
+inline void RationalSmallArray<N>::assign(const RationalArray& ra) {
+	clear();
+	reserve(ra.size());
+	for (const Rational& rationalObj : ra) {
+		add(rationalObj);
+	}
+}
+
+#endif
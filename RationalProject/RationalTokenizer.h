@@ -0,0 +1,187 @@
+/**
+* File: RationalTokenizer.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This header provides tokenizers that read consecutive rationals from a character range or an input stream, such as
+* rows of whitespace- or comma-separated values. Values are separated by any run of the delimiter characters, and each
+* is parsed in place with Rational::tryParse, so nothing is allocated per value; the stream tokenizer gathers each value
+* into a buffer that is reused.
+* Example: RationalTokenizer tokens(first, last); while (!tokens.atEnd()) { status = tokens.next(value); ... }
+*/
+
+#ifndef RATIONAL_TOKENIZER_H
+#define RATIONAL_TOKENIZER_H
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <string_view>
+
+#include "Rational.h"
+
+namespace rational {
+	// a set of delimiter characters, looked up in a table
+	class RationalDelimiters {
+	public:
+		// the default delimiters -- whitespace and commas
+		static constexpr const char* DEFAULT = " \t\r\n\v\f,";
+
+		// build the table from the characters of delimiters
+		explicit RationalDelimiters(const std::string& delimiters = DEFAULT);
+
+		// return true if the character is a delimiter
+		bool contains(const char c) const;
+
+	private:
+		// one entry per character value
+		bool table[256];
+	};
+
+	// reads consecutive rationals from the character range [first, last)
+	class RationalTokenizer {
+	public:
+		// tokenize [first, last), splitting on the delimiter characters
+		RationalTokenizer(const char* first, const char* last, const std::string& delimiters = RationalDelimiters::DEFAULT);
+
+		// skip delimiters, and return true if no values remain
+		bool atEnd();
+		// parse the next value into result, without throwing -- the status is as Rational::tryParse's, and
+		// STATUS_INVALID_FORMAT at the end of the range. The value is consumed whether or not it parses
+		template<typename IntT, typename GcdPolicy>
+		ArithmeticStatus next(BasicRational<IntT, GcdPolicy>& result);
+
+		// the text of the last value read
+		std::string_view token() const;
+		// the current position in the range
+		const char* position() const;
+
+	private:
+		// the unread characters
+		const char* first;
+		const char* last;
+		// the last value read
+		std::string_view lastToken;
+		// the delimiters
+		RationalDelimiters delimiters;
+	};
+
+	// reads consecutive rationals from an input stream
+	class RationalStreamTokenizer {
+	public:
+		// tokenize the stream, splitting on the delimiter characters -- the stream must outlive the tokenizer
+		explicit RationalStreamTokenizer(std::istream& is, const std::string& delimiters = RationalDelimiters::DEFAULT);
+
+		// skip delimiters, and return true if no values remain (setting eofbit on the stream)
+		bool atEnd();
+		// parse the next value into result, without throwing -- as RationalTokenizer::next
+		template<typename IntT, typename GcdPolicy>
+		ArithmeticStatus next(BasicRational<IntT, GcdPolicy>& result);
+
+		// the text of the last value read -- valid until the next value is read
+		std::string_view token() const;
+
+	private:
+		// the stream
+		std::istream& is;
+		// the last value read -- its capacity is reused for every value
+		std::string lastToken;
+		// the delimiters
+		RationalDelimiters delimiters;
+	};
+
+	// delimiters
+	inline RationalDelimiters::RationalDelimiters(const std::string& delimiters) : table() {
+		for (char c : delimiters) {
+			table[(unsigned char)c] = true;
+		}
+	}
+
+	inline bool RationalDelimiters::contains(const char c) const {
+		return table[(unsigned char)c];
+	}
+
+	// range tokenizer
+	inline RationalTokenizer::RationalTokenizer(const char* first, const char* last, const std::string& delimiters) : first(first), last(last), delimiters(delimiters) {}
+
+	inline bool RationalTokenizer::atEnd() {
+		while (first != last && delimiters.contains(*first)) {
+			first++;
+		}
+		return first == last;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus RationalTokenizer::next(BasicRational<IntT, GcdPolicy>& result) {
+		if (atEnd()) {
+			lastToken = std::string_view();
+			return STATUS_INVALID_FORMAT;
+		}
+
+		const char* tokenFirst = first;
+		while (first != last && !delimiters.contains(*first)) {
+			first++;
+		}
+		lastToken = std::string_view(tokenFirst, first - tokenFirst);
+		return BasicRational<IntT, GcdPolicy>::tryParse(tokenFirst, first, result);
+	}
+
+	inline std::string_view RationalTokenizer::token() const {
+		return lastToken;
+	}
+
+	inline const char* RationalTokenizer::position() const {
+		return first;
+	}
+
+	// stream tokenizer
+	inline RationalStreamTokenizer::RationalStreamTokenizer(std::istream& is, const std::string& delimiters) : is(is), delimiters(delimiters) {}
+
+	inline bool RationalStreamTokenizer::atEnd() {
+		typedef std::istream::traits_type stream_traits;
+		std::streambuf* buffer = is.rdbuf();
+		if (buffer == nullptr || !is.good()) {
+			return true;
+		}
+
+		for (stream_traits::int_type c = buffer->sgetc(); ; c = buffer->snextc()) {
+			if (stream_traits::eq_int_type(c, stream_traits::eof())) {
+				is.setstate(std::ios_base::eofbit);
+				return true;
+			}
+			if (!delimiters.contains(stream_traits::to_char_type(c))) {
+				return false;
+			}
+		}
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus RationalStreamTokenizer::next(BasicRational<IntT, GcdPolicy>& result) {
+		typedef std::istream::traits_type stream_traits;
+		lastToken.clear();
+		if (atEnd()) {
+			return STATUS_INVALID_FORMAT;
+		}
+
+		// the delimiter that ends the value is left in the stream
+		std::streambuf* buffer = is.rdbuf();
+		for (stream_traits::int_type c = buffer->sgetc(); ; c = buffer->snextc()) {
+			if (stream_traits::eq_int_type(c, stream_traits::eof())) {
+				is.setstate(std::ios_base::eofbit);
+				break;
+			}
+			char ch = stream_traits::to_char_type(c);
+			if (delimiters.contains(ch)) {
+				break;
+			}
+			lastToken += ch;
+		}
+		return BasicRational<IntT, GcdPolicy>::tryParse(lastToken.data(), lastToken.data() + lastToken.size(), result);
+	}
+
+	inline std::string_view RationalStreamTokenizer::token() const {
+		return lastToken;
+	}
+}
+
+#endif
@@ -0,0 +1,242 @@
+/**
+* File: UnreducedRational.h
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* This class provides an accumulator for chains of Rational operations that defers reduction to lowest terms.
+* Every Rational operation reduces its result, which costs a GCD per step; an UnreducedRational carries the raw
+* numerator and denominator through the chain instead, and reduces once when the value is converted back to a Rational.
+* When a step would overflow, both operands are reduced and the step is retried, so the deferral never loses range.
+* Example: Rational r = (UnreducedRational(a) + UnreducedRational(b) * c - d).toRational();
+*/
+
+#ifndef UNREDUCED_RATIONAL_H
+#define UNREDUCED_RATIONAL_H
+
+#include "Rational.h"
+
+namespace rational {
+	template<typename IntT, typename GcdPolicy = BinaryGcd>
+	class BasicUnreducedRational {
+	public:
+		// the rational type this accumulates
+		typedef BasicRational<IntT, GcdPolicy> rational_type;
+		// the integer type of the numerator and denominator
+		typedef IntT value_type;
+
+		// Constructors
+		// empty constructor -- the value is 0
+		BasicUnreducedRational();
+		// construct from a numerator and an optional denominator -- throws DivideByZeroException if the denominator is 0
+		BasicUnreducedRational(const IntT numerator, const IntT denominator = 1);
+		// construct from a rational
+		BasicUnreducedRational(const rational_type& rationalObj);
+
+		// get the (unreduced) numerator and denominator -- the denominator is always positive
+		IntT getNumerator() const;
+		IntT getDenominator() const;
+
+		// arithmetic -- none of these reduce unless the result would otherwise overflow
+		// (rationals and integers convert implicitly, so these also accept them)
+		BasicUnreducedRational& operator+=(const BasicUnreducedRational& other);
+		BasicUnreducedRational& operator-=(const BasicUnreducedRational& other);
+		BasicUnreducedRational& operator*=(const BasicUnreducedRational& other);
+		BasicUnreducedRational& operator/=(const BasicUnreducedRational& other);
+		BasicUnreducedRational operator+(const BasicUnreducedRational& other) const;
+		BasicUnreducedRational operator-(const BasicUnreducedRational& other) const;
+		BasicUnreducedRational operator*(const BasicUnreducedRational& other) const;
+		BasicUnreducedRational operator/(const BasicUnreducedRational& other) const;
+
+		// reduce the accumulated value to lowest terms in place
+		void reduce();
+		// return the accumulated value as a rational -- this is the one reduction of the chain
+		rational_type toRational() const;
+
+	private:
+		// numerator
+		IntT numerator;
+		// denominator -- kept positive
+		IntT denominator;
+
+		// add n/d to this value without reducing, returning STATUS_OVERFLOW (and leaving this unchanged) if it does not fit
+		ArithmeticStatus tryAdd(const IntT n, const IntT d);
+		// multiply this value by n/d without reducing, returning STATUS_OVERFLOW (and leaving this unchanged) if it does not fit
+		ArithmeticStatus tryMultiply(const IntT n, const IntT d);
+	};
+
+	// the accumulator types
+	typedef BasicUnreducedRational<int> UnreducedRational;
+	typedef BasicUnreducedRational<std::int64_t> UnreducedRational64;
+
+	// constructors
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy>::BasicUnreducedRational() : numerator(0), denominator(1) {}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy>::BasicUnreducedRational(const IntT numerator, const IntT denominator) : numerator(numerator), denominator(denominator) {
+		if (denominator == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		// move the sign to the numerator
+		if (denominator < 0) {
+			typedef IntegerTraits<IntT> traits;
+			if (traits::negateOverflow(this->numerator, this->numerator) || traits::negateOverflow(this->denominator, this->denominator)) {
+				throw exception::OverflowException(__FILE__, __LINE__);
+			}
+		}
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy>::BasicUnreducedRational(const rational_type& rationalObj) : numerator(rationalObj.getNumerator()), denominator(rationalObj.getDenominator()) {
+		// invalid rational
+		if (denominator == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+	}
+
+	// getters
+	template<typename IntT, typename GcdPolicy>
+	inline IntT BasicUnreducedRational<IntT, GcdPolicy>::getNumerator() const {
+		return numerator;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline IntT BasicUnreducedRational<IntT, GcdPolicy>::getDenominator() const {
+		return denominator;
+	}
+
+	// mutating arithmetic -- try without reducing, then reduce both operands and try once more before reporting overflow
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy>& BasicUnreducedRational<IntT, GcdPolicy>::operator+=(const BasicUnreducedRational& other) {
+		if (tryAdd(other.numerator, other.denominator) != STATUS_OK) {
+			BasicUnreducedRational reduced(other);
+			reduced.reduce();
+			reduce();
+			if (tryAdd(reduced.numerator, reduced.denominator) != STATUS_OK) {
+				throw exception::OverflowException(__FILE__, __LINE__);
+			}
+		}
+		return *this;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy>& BasicUnreducedRational<IntT, GcdPolicy>::operator-=(const BasicUnreducedRational& other) {
+		// add the negation
+		IntT negated;
+		if (IntegerTraits<IntT>::negateOverflow(other.numerator, negated)) {
+			throw exception::OverflowException(__FILE__, __LINE__);
+		}
+		return *this += BasicUnreducedRational(negated, other.denominator);
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy>& BasicUnreducedRational<IntT, GcdPolicy>::operator*=(const BasicUnreducedRational& other) {
+		if (tryMultiply(other.numerator, other.denominator) != STATUS_OK) {
+			BasicUnreducedRational reduced(other);
+			reduced.reduce();
+			reduce();
+			if (tryMultiply(reduced.numerator, reduced.denominator) != STATUS_OK) {
+				throw exception::OverflowException(__FILE__, __LINE__);
+			}
+		}
+		return *this;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy>& BasicUnreducedRational<IntT, GcdPolicy>::operator/=(const BasicUnreducedRational& other) {
+		// divide by zero
+		if (other.numerator == 0) {
+			throw exception::DivideByZeroException(__FILE__, __LINE__);
+		}
+
+		// multiply by the reciprocal -- the constructor moves its sign to the numerator
+		return *this *= BasicUnreducedRational(other.denominator, other.numerator);
+	}
+
+	// non-mutating arithmetic -- implemented in terms of the mutating counterparts
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy> BasicUnreducedRational<IntT, GcdPolicy>::operator+(const BasicUnreducedRational& other) const {
+		BasicUnreducedRational result(*this);
+		return result += other;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy> BasicUnreducedRational<IntT, GcdPolicy>::operator-(const BasicUnreducedRational& other) const {
+		BasicUnreducedRational result(*this);
+		return result -= other;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy> BasicUnreducedRational<IntT, GcdPolicy>::operator*(const BasicUnreducedRational& other) const {
+		BasicUnreducedRational result(*this);
+		return result *= other;
+	}
+
+	template<typename IntT, typename GcdPolicy>
+	inline BasicUnreducedRational<IntT, GcdPolicy> BasicUnreducedRational<IntT, GcdPolicy>::operator/(const BasicUnreducedRational& other) const {
+		BasicUnreducedRational result(*this);
+		return result /= other;
+	}
+
+	// reduce to lowest terms
+	template<typename IntT, typename GcdPolicy>
+	inline void BasicUnreducedRational<IntT, GcdPolicy>::reduce() {
+		// a zero value is 0/1
+		if (numerator == 0) {
+			denominator = 1;
+			return;
+		}
+
+		IntT gcd = GcdPolicy::gcd(numerator, denominator);
+		numerator /= gcd;
+		denominator /= gcd;
+	}
+
+	// convert to a rational -- the rational constructor performs the single reduction
+	template<typename IntT, typename GcdPolicy>
+	inline typename BasicUnreducedRational<IntT, GcdPolicy>::rational_type BasicUnreducedRational<IntT, GcdPolicy>::toRational() const {
+		return rational_type(numerator, denominator);
+	}
+
+	// add without reducing -- a shared denominator only needs the numerators added
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicUnreducedRational<IntT, GcdPolicy>::tryAdd(const IntT n, const IntT d) {
+		typedef IntegerTraits<IntT> traits;
+		IntT newNumerator, newDenominator;
+		if (denominator == d) {
+			if (traits::addOverflow(numerator, n, newNumerator)) {
+				return STATUS_OVERFLOW;
+			}
+			numerator = newNumerator;
+			return STATUS_OK;
+		}
+
+		// a/b + c/d = (a*d + c*b) / (b*d)
+		IntT term1, term2;
+		if (traits::mulOverflow(numerator, d, term1) ||
+			traits::mulOverflow(n, denominator, term2) ||
+			traits::addOverflow(term1, term2, newNumerator) ||
+			traits::mulOverflow(denominator, d, newDenominator)) {
+			return STATUS_OVERFLOW;
+		}
+		numerator = newNumerator;
+		denominator = newDenominator;
+		return STATUS_OK;
+	}
+
+	// multiply without reducing
+	template<typename IntT, typename GcdPolicy>
+	inline ArithmeticStatus BasicUnreducedRational<IntT, GcdPolicy>::tryMultiply(const IntT n, const IntT d) {
+		typedef IntegerTraits<IntT> traits;
+		IntT newNumerator, newDenominator;
+		if (traits::mulOverflow(numerator, n, newNumerator) || traits::mulOverflow(denominator, d, newDenominator)) {
+			return STATUS_OVERFLOW;
+		}
+		numerator = newNumerator;
+		denominator = newDenominator;
+		return STATUS_OK;
+	}
+}
+
+#endif
@@ -0,0 +1,107 @@
+/**
+* File: GcdBenchmark.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Microbenchmark comparing the GCD algorithms on random 32- and 64-bit inputs:
+* the recursive Euclid algorithm Fraction originally used, the iterative EuclidGcd policy,
+* and the binary BinaryGcd policy (the default).
+* Usage: GcdBenchmark [pairs] [repetitions]
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Gcd.h"
+
+using namespace rational;
+
+// the recursive Euclid algorithm, as originally used by Fraction::getGcd
+template<typename IntT>
+IntT recursiveEuclidGcd(const IntT divisor, const IntT remainder) {
+	return (remainder == 0) ? divisor : recursiveEuclidGcd(remainder, divisor % remainder);
+}
+
+// recursive Euclid, wrapped as a policy (inputs are positive, so no magnitudes are needed)
+struct RecursiveEuclidGcd {
+	template<typename IntT>
+	static IntT gcd(const IntT a, const IntT b) {
+		return recursiveEuclidGcd(a, b);
+	}
+};
+
+// time the gcd of every pair, returning the best nanoseconds per gcd over the repetitions
+template<typename Policy, typename IntT>
+double timeGcd(const std::vector<IntT>& lhs, const std::vector<IntT>& rhs, const int repetitions, IntT& checksum) {
+	double best = 0;
+	for (int rep = 0; rep < repetitions; rep++) {
+		IntT sum = 0;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < lhs.size(); i++) {
+			sum += Policy::gcd(lhs[i], rhs[i]);
+		}
+		std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+		double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count() / lhs.size();
+		if (rep == 0 || nanoseconds < best) {
+			best = nanoseconds;
+		}
+		checksum = sum;
+	}
+	return best;
+}
+
+// run the benchmark for one integer width
+template<typename IntT>
+bool runBenchmark(const std::string& name, const std::size_t pairs, const int repetitions) {
+	// fixed seed so runs are comparable; positive inputs so every algorithm sees the same problem
+	std::mt19937_64 generator(20150301);
+	std::uniform_int_distribution<IntT> distribution(1, std::numeric_limits<IntT>::max());
+	std::vector<IntT> lhs(pairs);
+	std::vector<IntT> rhs(pairs);
+	for (std::size_t i = 0; i < pairs; i++) {
+		lhs[i] = distribution(generator);
+		rhs[i] = distribution(generator);
+	}
+
+	IntT recursiveSum = 0;
+	IntT euclidSum = 0;
+	IntT binarySum = 0;
+	double recursive = timeGcd<RecursiveEuclidGcd>(lhs, rhs, repetitions, recursiveSum);
+	double euclid = timeGcd<EuclidGcd>(lhs, rhs, repetitions, euclidSum);
+	double binary = timeGcd<BinaryGcd>(lhs, rhs, repetitions, binarySum);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << name << " (" << pairs << " pairs, best of " << repetitions << ")" << std::endl;
+	std::cout << "  recursive Euclid: " << recursive << " ns/gcd" << std::endl;
+	std::cout << "  iterative Euclid: " << euclid << " ns/gcd" << std::endl;
+	std::cout << "  binary (ctz):     " << binary << " ns/gcd  (" << recursive / binary << "x vs recursive)" << std::endl;
+
+	// the checksums double as a correctness check, and keep the loops from being optimized away
+	if (recursiveSum != euclidSum || recursiveSum != binarySum) {
+		std::cout << "  MISMATCH: the algorithms disagree" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+int main(int argc, char* argv[]) {
+	std::size_t pairs = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+	int repetitions = (argc > 2) ? std::atoi(argv[2]) : 5;
+	if (pairs == 0 || repetitions <= 0) {
+		std::cout << "Usage: GcdBenchmark [pairs] [repetitions]" << std::endl;
+		return 1;
+	}
+
+	bool ok = runBenchmark<std::int32_t>("32-bit", pairs, repetitions);
+	ok = runBenchmark<std::int64_t>("64-bit", pairs, repetitions) && ok;
+
+	return ok ? 0 : 1;
+}
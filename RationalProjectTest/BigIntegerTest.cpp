@@ -0,0 +1,117 @@
+/*
+* File: BigIntegerTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* BigInteger class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "BigInteger.h"
+
+#include <cstdint>
+#include <limits>
+#include <gtest/gtest.h>
+using namespace rational;
+using namespace rational::exception;
+
+// test that small values stay inline
+TEST(BigIntegerTest, TestSmallValues) {
+	BigInteger a(12);
+	BigInteger b(-30);
+
+	EXPECT_TRUE(a.isSmall());
+	EXPECT_EQ(BigInteger(-18), a + b);
+	EXPECT_EQ(BigInteger(42), a - b);
+	EXPECT_EQ(BigInteger(-360), a * b);
+	EXPECT_EQ(BigInteger(-2), b / a);
+	EXPECT_EQ(BigInteger(-6), b % a);
+	EXPECT_TRUE((a * b).isSmall());
+	EXPECT_TRUE(b < a);
+	EXPECT_EQ("-30", b.toString());
+}
+
+// test promotion on overflow and demotion when the value fits again
+TEST(BigIntegerTest, TestPromotion) {
+	BigInteger max(std::numeric_limits<std::int64_t>::max());
+	BigInteger sum = max + 1;
+
+	EXPECT_FALSE(sum.isSmall());
+	EXPECT_EQ("9223372036854775808", sum.toString());
+	EXPECT_TRUE(sum > max);
+
+	// back in range
+	BigInteger difference = sum - 1;
+	EXPECT_TRUE(difference.isSmall());
+	EXPECT_EQ(max, difference);
+
+	// the minimum value negates into a promoted value
+	BigInteger min(std::numeric_limits<std::int64_t>::min());
+	EXPECT_EQ("9223372036854775808", (-min).toString());
+	EXPECT_EQ(min, -(-min));
+}
+
+// test multi-limb multiplication and division
+TEST(BigIntegerTest, TestMultiplyDivide) {
+	// 30!
+	BigInteger factorial(1);
+	for (int i = 2; i <= 30; i++) {
+		factorial *= i;
+	}
+	EXPECT_EQ("265252859812191058636308480000000", factorial.toString());
+
+	// divide back down
+	BigInteger quotient = factorial;
+	for (int i = 30; i >= 2; i--) {
+		EXPECT_EQ(BigInteger(0), quotient % i);
+		quotient /= i;
+	}
+	EXPECT_EQ(BigInteger(1), quotient);
+
+	// multi-limb divisor with a remainder
+	BigInteger divisor = BigInteger(1000000007) * BigInteger(998244353) * BigInteger(1000003);
+	BigInteger dividend = factorial + 12345;
+	BigInteger q = dividend / divisor;
+	BigInteger r = dividend % divisor;
+	EXPECT_EQ(dividend, q * divisor + r);
+	EXPECT_TRUE(r < divisor);
+
+	// remainder takes the sign of the dividend
+	EXPECT_EQ(-r, (-dividend) % divisor);
+	EXPECT_EQ(-q, (-dividend) / divisor);
+}
+
+// test conversions
+TEST(BigIntegerTest, TestConversions) {
+	BigInteger big(1e30);
+	EXPECT_DOUBLE_EQ(1e30, big.toDouble());
+	EXPECT_EQ(BigInteger(-7), BigInteger(-7.9));
+
+	BigInteger unsignedMax(std::numeric_limits<std::uint64_t>::max());
+	EXPECT_EQ("18446744073709551615", unsignedMax.toString());
+
+	// conversion back to built-in integers
+	EXPECT_EQ(-7, BigInteger(-7).toIntegral<int>());
+	EXPECT_EQ(std::numeric_limits<std::uint64_t>::max(), unsignedMax.toIntegral<std::uint64_t>());
+
+#ifdef __SIZEOF_INT128__
+	__int128 wide = -((__int128)1 << 100) - 5;
+	BigInteger big128(wide);
+	EXPECT_EQ("-1267650600228229401496703205381", big128.toString());
+	EXPECT_TRUE(big128.toIntegral<__int128>() == wide);
+#endif
+}
+
+// test divide by zero
+TEST(BigIntegerTest, TestDivideByZeroException) {
+	BigInteger big = BigInteger(std::numeric_limits<std::int64_t>::max()) * 4;
+	try {
+		big / 0;
+		FAIL();
+	}
+	catch (DivideByZeroException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
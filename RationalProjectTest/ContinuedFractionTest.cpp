@@ -0,0 +1,123 @@
+/*
+* File: ContinuedFractionTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* Continued fraction, convergent and bounded-denominator approximation unit tests - written for use with the GoogleTest framework
+*/
+
+#include "ContinuedFraction.h"
+#include "DivideByZeroException.h"
+#include "InvalidArgumentException.h"
+
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+using namespace rational;
+using namespace rational::exception;
+
+// test the terms of the continued fraction
+TEST(ContinuedFractionTest, TestTerms) {
+	EXPECT_EQ(std::vector<int>({ 1, 2, 3, 4 }), Rational(43, 30).continuedFraction());
+	EXPECT_EQ(std::vector<int>({ 0, 3 }), Rational(1, 3).continuedFraction());
+	EXPECT_EQ(std::vector<int>({ 5 }), Rational(5).continuedFraction());
+	EXPECT_EQ(std::vector<int>({ 0 }), Rational(0).continuedFraction());
+	// negative values start with their floor
+	EXPECT_EQ(std::vector<int>({ -3, 1, 2 }), Rational(-7, 3).continuedFraction());
+	EXPECT_EQ(std::vector<int>({ INT_MIN }), Rational(INT_MIN).continuedFraction());
+	EXPECT_EQ(std::vector<std::int64_t>({ 3, 7, 16 }), Rational64(355, 113).continuedFraction());
+}
+
+// test stepping through the convergents
+TEST(ContinuedFractionTest, TestConvergents) {
+	Convergents convergents(Rational(43, 30));
+	std::vector<Rational> expected = { Rational(1), Rational(3, 2), Rational(10, 7), Rational(43, 30) };
+	std::vector<int> terms = { 1, 2, 3, 4 };
+	for (std::size_t i = 0; i < expected.size(); i++) {
+		EXPECT_TRUE(convergents.next());
+		EXPECT_EQ(terms[i], convergents.term());
+		EXPECT_EQ(expected[i], convergents.convergent());
+		EXPECT_EQ(i + 1, convergents.index());
+	}
+	EXPECT_FALSE(convergents.next());
+	EXPECT_EQ(Rational(43, 30), convergents.convergent());
+
+	// negative values, and the limits of the type
+	Convergents negative(Rational(-7, 3));
+	EXPECT_TRUE(negative.next());
+	EXPECT_EQ(Rational(-3), negative.convergent());
+	EXPECT_TRUE(negative.next());
+	EXPECT_EQ(Rational(-2), negative.convergent());
+	EXPECT_TRUE(negative.next());
+	EXPECT_EQ(Rational(-7, 3), negative.convergent());
+	EXPECT_FALSE(negative.next());
+
+	Rational last;
+	Convergents limits(Rational(INT_MAX, INT_MAX - 1));
+	while (limits.next()) {
+		last = limits.convergent();
+	}
+	EXPECT_EQ(Rational(INT_MAX, INT_MAX - 1), last);
+
+	try {
+		Rational invalid;
+		invalid.setDenominator(0);
+		Convergents failed(invalid);
+		FAIL();
+	}
+	catch (DivideByZeroException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
+// test the closest rational with a bounded denominator
+TEST(ContinuedFractionTest, TestLimitDenominator) {
+	EXPECT_EQ(Rational(355, 113), Rational(3141592, 1000000).limitDenominator(1000));
+	EXPECT_EQ(Rational(22, 7), Rational(3141592, 1000000).limitDenominator(10));
+	EXPECT_EQ(Rational(3), Rational(3141592, 1000000).limitDenominator(1));
+	// within the bound the value is unchanged
+	EXPECT_EQ(Rational(2, 3), Rational(2, 3).limitDenominator(3));
+	EXPECT_EQ(Rational(2, 3), Rational(2, 3).limitDenominator(100));
+	// a semiconvergent can be closer than the last convergent within the bound
+	EXPECT_EQ(Rational(1, 2), Rational(3, 10).limitDenominator(2));
+	EXPECT_EQ(Rational(-1, 3), Rational(-333, 1000).limitDenominator(10));
+	EXPECT_EQ(Rational(INT_MIN), Rational(INT_MIN).limitDenominator(1));
+	EXPECT_EQ(Rational(-715827883), Rational(INT_MIN, 3).limitDenominator(1));
+	EXPECT_EQ(Rational(-1), Rational(INT_MIN, INT_MAX).limitDenominator(2));
+	EXPECT_EQ(Rational64(355, 113), Rational64(3141592653589793LL, 1000000000000000LL).limitDenominator(1000));
+	EXPECT_EQ(BigRational(355, 113), BigRational(3141592, 1000000).limitDenominator(1000));
+
+	try {
+		Rational(1, 3).limitDenominator(0);
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
+// test the best approximation of a double
+TEST(ContinuedFractionTest, TestApproximate) {
+	EXPECT_EQ(Rational(355, 113), Rational::approximate(3.14159265, 1000));
+	EXPECT_EQ(Rational(1, 3), Rational::approximate(0.3333333333, 100));
+	EXPECT_EQ(Rational(-5, 7), Rational::approximate(-0.714, 10));
+	EXPECT_EQ(Rational(2), Rational::approximate(2.0, 7));
+
+	try {
+		Rational::approximate(0.5, -1);
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
@@ -0,0 +1,60 @@
+/*
+* File: GcdTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* GCD policy unit tests - written for use with the GoogleTest framework
+*/
+
+#include "Gcd.h"
+#include "Rational.h"
+
+#include <cstdint>
+#include <limits>
+#include <gtest/gtest.h>
+using namespace rational;
+
+// test count trailing zeros against the portable loop
+TEST(GcdTest, TestCountTrailingZeros) {
+	EXPECT_EQ(0, countTrailingZeros(1u));
+	EXPECT_EQ(3, countTrailingZeros(40u));
+	EXPECT_EQ(31, countTrailingZeros(0x80000000u));
+	EXPECT_EQ(63, countTrailingZeros((std::uint64_t)1 << 63));
+
+	for (std::uint64_t value = 1; value < 5000; value += 7) {
+		EXPECT_EQ(countTrailingZerosPortable(value), countTrailingZeros(value));
+	}
+}
+
+// test that the binary and Euclid policies agree, including signs and zero
+TEST(GcdTest, TestPoliciesAgree) {
+	EXPECT_EQ(6, BinaryGcd::gcd(48, 18));
+	EXPECT_EQ(6, BinaryGcd::gcd(-48, 18));
+	EXPECT_EQ(6, BinaryGcd::gcd(48, -18));
+	EXPECT_EQ(7, BinaryGcd::gcd(0, 7));
+	EXPECT_EQ(7, BinaryGcd::gcd(-7, 0));
+	EXPECT_EQ(0, BinaryGcd::gcd(0, 0));
+
+	for (int a = -60; a <= 60; a++) {
+		for (int b = -60; b <= 60; b++) {
+			EXPECT_EQ(EuclidGcd::gcd(a, b), BinaryGcd::gcd(a, b));
+		}
+	}
+
+	std::int64_t big = (std::int64_t)1 << 40;
+	EXPECT_EQ(big, BinaryGcd::gcd(big * 3, big * 5));
+	EXPECT_EQ(EuclidGcd::gcd(big * 3, big * 5), BinaryGcd::gcd(big * 3, big * 5));
+	// the magnitude of the minimum value does not overflow
+	EXPECT_EQ(8, BinaryGcd::gcd(std::numeric_limits<int>::min(), 24));
+	EXPECT_EQ(BigInteger(6), BinaryGcd::gcd(BigInteger(48), BigInteger(-18)));
+}
+
+// test that the policy can be selected on a rational
+TEST(GcdTest, TestEuclidPolicy) {
+	typedef BasicRational<int, EuclidGcd> EuclidRational;
+	EuclidRational r1(6, -8);
+	EuclidRational r2(1, 4);
+
+	EXPECT_EQ(EuclidRational(-1, 2), r1 + r2);
+	EXPECT_EQ(Rational(-3, 4), Rational(6, -8));
+}
@@ -0,0 +1,142 @@
+/*
+* File: RationalArrayFileTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* RationalArrayFileWriter and MappedRationalArray class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "RationalArrayFile.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+using namespace rational;
+using namespace rational::exception;
+
+// test writing a file and mapping it back
+TEST(RationalArrayFileTest, TestWriteAndMap) {
+	const char* fileName = "RationalArrayFileTest.bin";
+	RationalArray ra;
+	ra.add(Rational(1, 2));
+	ra.add(Rational(-3, 4));
+	{
+		RationalArrayFileWriter writer(fileName);
+		writer.append(ra);
+		for (int i = 0; i < 10000; i++) {
+			writer.append(Rational(i, 7));
+		}
+		writer.append(Rational(INT_MIN, INT_MAX));
+		EXPECT_EQ(10003u, writer.size());
+		writer.close();
+	}
+
+	{
+		std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+		EXPECT_EQ(16 + 10003 * 8, (int)file.tellg());
+	}
+
+	MappedRationalArray mapped(fileName);
+	ASSERT_EQ(10003u, mapped.size());
+	EXPECT_EQ(Rational(1, 2), mapped.retrieve(0));
+	EXPECT_EQ(Rational(-3, 4), mapped.retrieve(1));
+	EXPECT_EQ(Rational(9999, 7), mapped.retrieve(10001));
+	EXPECT_EQ(Rational(INT_MIN, INT_MAX), mapped.retrieve(10002));
+	EXPECT_EQ(-3, mapped.data()[1].numerator);
+
+	// iteration reads the records in place
+	int index = 0;
+	for (Rational value : mapped) {
+		EXPECT_EQ(mapped.retrieve(index++), value);
+	}
+	EXPECT_EQ(10003, index);
+	EXPECT_EQ(10003, mapped.end() - mapped.begin());
+	EXPECT_EQ(Rational(-3, 4), *std::min_element(mapped.begin(), mapped.end() - 1));
+	EXPECT_EQ(Rational(0), mapped.begin()[2]);
+
+	RationalArray copy;
+	mapped.copyTo(copy);
+	EXPECT_EQ(10003u, copy.size());
+	EXPECT_EQ(Rational(9999, 7), copy.retrieve(10001));
+
+	try {
+		// this should throw an exception
+		mapped.retrieve(10003);
+		FAIL();
+	}
+	catch (ArrayIndexOutOfBoundsException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+	std::remove(fileName);
+}
+
+// test that the writer closes itself, and that an unfinished file is empty
+TEST(RationalArrayFileTest, TestWriterClose) {
+	const char* fileName = "RationalArrayFileTest.bin";
+	{
+		RationalArrayFileWriter writer(fileName);
+		writer.append(Rational(5));
+	}
+	EXPECT_EQ(1u, MappedRationalArray(fileName).size());
+
+	RationalArrayFileWriter writer(fileName);
+	writer.append(Rational(5));
+	EXPECT_EQ(0u, MappedRationalArray(fileName).size());
+	writer.close();
+	EXPECT_EQ(1u, MappedRationalArray(fileName).size());
+
+	try {
+		// this should throw an exception
+		writer.append(Rational(6));
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+	std::remove(fileName);
+}
+
+// test mapping files that are not rational array files
+TEST(RationalArrayFileTest, TestMapInvalid) {
+	const char* fileName = "RationalArrayFileTest.bin";
+	const char* contents[] = { "RATM", "RATX\x01\x08\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", "RATM\x02\x08\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00", "RATM\x01\x08\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00" };
+	const std::size_t sizes[] = { 4, 16, 16, 16 };
+	for (int i = 0; i < 4; i++) {
+		{
+			std::ofstream file(fileName, std::ios::binary);
+			file.write(contents[i], sizes[i]);
+		}
+		try {
+			// this should throw an exception
+			MappedRationalArray mapped(fileName);
+			FAIL();
+		}
+		catch (InvalidFormatException &ex) {
+			std::cout << ex << std::endl;
+		}
+		catch (std::exception) {
+			FAIL();
+		}
+	}
+	std::remove(fileName);
+
+	try {
+		// this should throw an exception
+		MappedRationalArray mapped(fileName);
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
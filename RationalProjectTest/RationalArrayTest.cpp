@@ -8,6 +8,12 @@
 
 #include "RationalArray.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <numeric>
+#include <utility>
+#include <sstream>
+#include <string>
 #include <gtest/gtest.h>
 using namespace rational;
 using namespace rational::exception;
@@ -59,8 +65,13 @@ TEST_F(RationalArrayTest, TestSize) {
 TEST_F(RationalArrayTest, TestClear) {
 	ASSERT_EQ(3, ra.size()); // assert has elements
 
+	std::size_t capacity = ra.capacity();
 	ra.clear();
 	EXPECT_EQ(0, ra.size());
+	EXPECT_EQ(capacity, ra.capacity()); // the storage is kept
+
+	ra.add(Rational(2, 3));
+	EXPECT_EQ(Rational(2, 3), ra.retrieve(0));
 }
 
 // test adding
@@ -239,6 +250,35 @@ TEST_F(RationalArrayTest, TestAddAndResize) {
 	ra.add(Rational(5, 6));
 	ASSERT_TRUE(ra.capacity() > 3); // assert greater than what we started with
 	ASSERT_EQ(4, ra.size()); // ensure we added our element
+
+	// the elements move with the storage
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(1));
+	EXPECT_EQ(Rational(5, 6), ra.retrieve(3));
+
+	// adding an element of the array itself, while it grows
+	while (ra.size() < ra.capacity()) {
+		ra.add(Rational(1));
+	}
+	ra.add(ra.retrieve(3));
+	EXPECT_EQ(Rational(5, 6), ra.retrieve((int)ra.size() - 1));
+}
+
+// test that a copy holds elements of its own
+TEST_F(RationalArrayTest, TestCopyIsIndependent) {
+	RationalArray copy(ra);
+	copy.replace(0, Rational(7, 8));
+	ra.remove(1);
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(0));
+	EXPECT_EQ(Rational(1, 4), ra.retrieve(1));
+	EXPECT_EQ(Rational(7, 8), copy.retrieve(0));
+	EXPECT_EQ(Rational(1, 3), copy.retrieve(1));
+	EXPECT_EQ(3u, copy.size());
+
+	RationalArray assigned;
+	assigned = copy;
+	copy.clear();
+	EXPECT_EQ(3u, assigned.size());
+	EXPECT_EQ(Rational(1, 4), assigned.retrieve(2));
 }
 
 // test equality
@@ -273,4 +313,246 @@ TEST_F(RationalArrayTest, TestPrintArray) {
 	catch (std::exception) {
 		FAIL();
 	}
+
+	// the array is printed in the format set on std::cout
+	std::stringstream ss;
+	std::streambuf* coutBuffer = std::cout.rdbuf(ss.rdbuf());
+	std::cout << usedecimal;
+	ra.printArray();
+	ra.printArray();
+	std::cout.rdbuf(coutBuffer);
+	EXPECT_EQ("0.5\n0.3333333333333333\n0.25\n1/2\n1/3\n1/4\n", ss.str());
+}
+
+// test writing to the sinks
+TEST_F(RationalArrayTest, TestWriteTo) {
+	std::stringstream ss;
+	ra.writeTo(ss);
+	EXPECT_EQ("1/2\n1/3\n1/4", ss.str());
+
+	ss.str("");
+	ra.writeTo(ss, Rational::DECIMAL, ", ");
+	EXPECT_EQ("0.5, 0.3333333333333333, 0.25", ss.str());
+
+	// without a type, the format set on the stream is used -- a one-shot format applies to one write
+	ss.str("");
+	ss << setrationalformat(Rational::DECIMAL);
+	ra.writeTo(ss, " ");
+	ss << ' ';
+	ra.writeTo(ss, Rational::FRACTION, " ");
+	ss << ' ' << usefraction;
+	ra.writeTo(ss, " ");
+	ss << ' ';
+	ra.writeTo(ss, " ");
+	EXPECT_EQ("0.5 0.3333333333333333 0.25 1/2 1/3 1/4 1/2 1/3 1/4 0.5 0.3333333333333333 0.25", ss.str());
+
+	// a large array goes to the sink in a few big blocks
+	RationalArray large;
+	std::string expected;
+	for (int i = 0; i < 100000; i++) {
+		large.add(Rational(i, 7));
+		expected += Rational(i, 7).toString() + ",";
+	}
+	expected.pop_back();
+	std::string actual;
+	int blocks = 0;
+	large.writeTo([&actual, &blocks](const char* data, std::size_t size) {
+		actual.append(data, size);
+		blocks++;
+	}, Rational::FRACTION, ",");
+	EXPECT_EQ(expected, actual);
+	EXPECT_GT(30, blocks);
+
+	// file descriptors
+	std::FILE* file = std::tmpfile();
+	ASSERT_TRUE(file != nullptr);
+	large.writeTo(fileno(file), Rational::FRACTION, ",");
+	std::rewind(file);
+	std::string contents(expected.size() + 1, '\0');
+	contents.resize(std::fread(&contents[0], 1, contents.size(), file));
+	std::fclose(file);
+	EXPECT_EQ(expected, contents);
+
+	// nothing is written for an empty array
+	RationalArray empty;
+	ss.str("");
+	empty.writeTo(ss);
+	EXPECT_EQ("", ss.str());
+
+	try {
+		// this should throw an exception
+		ra.writeTo(-1);
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
+// test raising every element to a power
+TEST_F(RationalArrayTest, TestPow) {
+	ra.pow(2);
+	EXPECT_EQ(Rational(1, 4), ra.retrieve(0));
+	EXPECT_EQ(Rational(1, 9), ra.retrieve(1));
+	EXPECT_EQ(Rational(1, 16), ra.retrieve(2));
+
+	ra.pow(-3);
+	EXPECT_EQ(Rational(64), ra.retrieve(0));
+	EXPECT_EQ(Rational(4096), ra.retrieve(2));
+
+	// an overflow leaves the container unchanged
+	try {
+		ra.pow(3);
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+	EXPECT_EQ(Rational(64), ra.retrieve(0));
+	EXPECT_EQ(3u, ra.size());
+}
+
+// test bounding the denominators, and adding approximations of doubles
+TEST_F(RationalArrayTest, TestLimitDenominator) {
+	ra.limitDenominator(3);
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(0));
+	EXPECT_EQ(Rational(1, 3), ra.retrieve(1));
+	EXPECT_EQ(Rational(1, 3), ra.retrieve(2));
+
+	ra.addApproximations({ 3.14159265, -0.5 }, 100);
+	EXPECT_EQ(5u, ra.size());
+	EXPECT_EQ(Rational(311, 99), ra.retrieve(3));
+	EXPECT_EQ(Rational(-1, 2), ra.retrieve(4));
+
+	// a value that does not fit adds nothing
+	try {
+		ra.addApproximations({ 0.25, 1e300 }, 100);
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+	EXPECT_EQ(5u, ra.size());
+
+	try {
+		ra.limitDenominator(0);
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
+// test iterators and unchecked access
+TEST_F(RationalArrayTest, TestIterators) {
+	// standard algorithms work on the elements in place
+	EXPECT_EQ(Rational(13, 12), std::accumulate(ra.begin(), ra.end(), Rational(0)));
+	std::sort(ra.begin(), ra.end());
+	EXPECT_EQ(Rational(1, 4), ra[0]);
+	EXPECT_EQ(Rational(1, 2), ra[2]);
+	EXPECT_EQ(3, ra.end() - ra.begin());
+
+	// references reach the stored elements
+	ra[1] += Rational(1, 6);
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(1));
+	for (Rational& rationalObj : ra) {
+		rationalObj *= 2;
+	}
+	EXPECT_EQ(Rational(1), ra.retrieve(2));
+
+	// const access, and the span of the elements
+	const RationalArray& constArray = ra;
+	EXPECT_EQ(&ra[0], constArray.data());
+	EXPECT_EQ(constArray.cbegin() + constArray.size(), constArray.cend());
+	EXPECT_EQ(Rational(1, 2), constArray.data()[0]);
+	EXPECT_EQ(2, std::count(constArray.begin(), constArray.end(), Rational(1)));
+}
+
+// test moving arrays
+TEST_F(RationalArrayTest, TestMove) {
+	const Rational* elements = ra.data();
+	RationalArray moved(std::move(ra));
+	EXPECT_EQ(elements, moved.data()); // the storage moves, the elements are not copied
+	EXPECT_EQ(3u, moved.size());
+	EXPECT_EQ(Rational(1, 3), moved.retrieve(1));
+	EXPECT_EQ(0u, ra.size());
+	EXPECT_EQ(0u, ra.capacity());
+
+	// a moved-from array can be reused
+	ra.add(Rational(5));
+	EXPECT_EQ(Rational(5), ra.retrieve(0));
+
+	RationalArray assigned;
+	assigned = std::move(moved);
+	EXPECT_EQ(elements, assigned.data());
+	EXPECT_EQ(Rational(1, 4), assigned.retrieve(2));
+}
+
+// test resizing, shrinking and constructing in place
+TEST_F(RationalArrayTest, TestResize) {
+	ra.resize(5);
+	EXPECT_EQ(5u, ra.size());
+	EXPECT_EQ(Rational(1, 4), ra.retrieve(2));
+	EXPECT_EQ(Rational(0), ra.retrieve(4));
+
+	ra.resize(2);
+	EXPECT_EQ(2u, ra.size());
+	EXPECT_EQ(Rational(1, 3), ra.retrieve(1));
+
+	ra.shrink_to_fit();
+	EXPECT_EQ(2u, ra.capacity());
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(0));
+
+	// emplace_back reduces, and grows the container
+	Rational& element = ra.emplace_back(6, -8);
+	EXPECT_EQ(Rational(-3, 4), element);
+	EXPECT_EQ(3u, ra.size());
+	EXPECT_EQ(Rational(-3, 4), ra.retrieve(2));
+	EXPECT_EQ(Rational(7), ra.emplace_back(7));
+
+	// growing one element at a time reallocates geometrically, where reserve is exact
+	RationalArray grown;
+	int reallocations = 0;
+	for (std::size_t i = 1; i <= 1000; i++) {
+		const Rational* elements = grown.data();
+		grown.resize(i);
+		reallocations += (grown.data() != elements);
+	}
+	EXPECT_EQ(1000u, grown.size());
+	EXPECT_GT(25, reallocations);
+	std::size_t capacity = grown.capacity();
+	grown.reserve(capacity + 1);
+	EXPECT_EQ(capacity + 1, grown.capacity());
+	RationalArray exact;
+	exact.reserve(27);
+	EXPECT_EQ(27u, exact.capacity());
+	exact.resize(30);
+	EXPECT_EQ(40u, exact.capacity());
+	exact.resize(100);
+	EXPECT_EQ(100u, exact.capacity());
+
+	// a zero denominator adds nothing
+	try {
+		ra.emplace_back(1, 0);
+		FAIL();
+	}
+	catch (DivideByZeroException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+	EXPECT_EQ(4u, ra.size());
 }
@@ -0,0 +1,143 @@
+/*
+* File: RationalColumnTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* RationalColumn class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "RationalColumn.h"
+#include "ArrayIndexOutOfBoundsException.h"
+#include "DivideByZeroException.h"
+
+#include <climits>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+using namespace rational;
+using namespace rational::exception;
+
+// rational column class test fixture
+class RationalColumnTest : public ::testing::Test {
+protected:
+	virtual void SetUp() {
+		column.add(Rational(1, 2));
+		column.add(Rational(-1, 3));
+		column.add(Rational(6, 8));
+	}
+
+	RationalColumn column;
+};
+
+// test the container operations
+TEST_F(RationalColumnTest, TestContainer) {
+	EXPECT_EQ(3u, column.size());
+	EXPECT_EQ(Rational(1, 2), column.retrieve(0));
+	EXPECT_EQ(Rational(3, 4), column.retrieve(2));
+
+	// the lanes hold the elements in lowest terms
+	EXPECT_EQ(-1, column.numerators()[1]);
+	EXPECT_EQ(3, column.denominators()[1]);
+	EXPECT_EQ(4, column.denominators()[2]);
+
+	column.replace(1, Rational(5));
+	EXPECT_EQ(Rational(5), column.retrieve(1));
+	EXPECT_EQ(Rational(5), column.remove(1));
+	EXPECT_EQ(2u, column.size());
+	EXPECT_EQ(Rational(3, 4), column.retrieve(1));
+
+	// growing keeps the elements, and both lanes aligned
+	for (int i = 1; i <= 100; i++) {
+		column.add(Rational(i, i + 1));
+	}
+	EXPECT_EQ(102u, column.size());
+	EXPECT_EQ(Rational(100, 101), column.retrieve(101));
+	EXPECT_EQ(Rational(3, 4), column.retrieve(1));
+	EXPECT_EQ(0u, (std::uintptr_t)column.numerators() % RationalColumn::LANE_ALIGNMENT);
+	EXPECT_EQ(0u, (std::uintptr_t)column.denominators() % RationalColumn::LANE_ALIGNMENT);
+
+	// clearing keeps the capacity
+	std::size_t capacity = column.capacity();
+	column.clear();
+	EXPECT_EQ(0u, column.size());
+	EXPECT_EQ(capacity, column.capacity());
+}
+
+// test bounds and invalid elements
+TEST_F(RationalColumnTest, TestExceptions) {
+	try {
+		column.retrieve(3);
+		FAIL();
+	}
+	catch (ArrayIndexOutOfBoundsException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	try {
+		column.remove(-1);
+		FAIL();
+	}
+	catch (ArrayIndexOutOfBoundsException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	try {
+		Rational invalid;
+		invalid.setDenominator(0);
+		column.add(invalid);
+		FAIL();
+	}
+	catch (DivideByZeroException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+	EXPECT_EQ(3u, column.size());
+}
+
+// test copies, moves and conversion to and from RationalArray
+TEST_F(RationalColumnTest, TestConversion) {
+	RationalArray rationals;
+	column.copyTo(rationals);
+	EXPECT_EQ(3u, rationals.size());
+	EXPECT_EQ(Rational(-1, 3), rationals.retrieve(1));
+
+	RationalColumn converted(rationals);
+	EXPECT_EQ(column, converted);
+
+	RationalColumn copy(column);
+	copy.replace(0, Rational(7));
+	EXPECT_NE(column, copy);
+	EXPECT_EQ(Rational(1, 2), column.retrieve(0));
+
+	RationalColumn moved(std::move(copy));
+	EXPECT_EQ(Rational(7), moved.retrieve(0));
+	copy = moved;
+	EXPECT_EQ(moved, copy);
+}
+
+// test the bulk kernels
+TEST_F(RationalColumnTest, TestKernels) {
+	std::vector<double> values(column.size());
+	column.toDoubles(values.data());
+	EXPECT_DOUBLE_EQ(0.5, values[0]);
+	EXPECT_DOUBLE_EQ(-1.0 / 3, values[1]);
+	EXPECT_DOUBLE_EQ(0.75, values[2]);
+
+	EXPECT_EQ(1u, column.countLessThan(Rational(0)));
+	EXPECT_EQ(2u, column.countLessThan(Rational(3, 4)));
+	EXPECT_EQ(3u, column.countLessThan(Rational(1)));
+
+	// the cross products do not overflow
+	column.add(Rational(INT_MAX, INT_MAX - 1));
+	EXPECT_EQ(4u, column.countLessThan(Rational(INT_MAX - 1, INT_MAX - 2)));
+	EXPECT_EQ(3u, column.countLessThan(Rational(INT_MAX, INT_MAX - 1)));
+}
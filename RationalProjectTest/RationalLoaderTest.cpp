@@ -0,0 +1,95 @@
+/*
+* File: RationalLoaderTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* RationalLoader class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "RationalLoader.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+using namespace rational;
+using namespace rational::exception;
+
+// test loading a small buffer, with bad lines reported by line number
+TEST(RationalLoaderTest, TestLoad) {
+	std::string text = "1/2\n-0.75\r\n\n4/x\n12.5/2.5\n1/0\n99999999999\n7";
+	RationalArray ra;
+	std::vector<RationalParseError> errors;
+
+	EXPECT_EQ(4u, RationalLoader::load(text.data(), text.data() + text.size(), ra, errors));
+	EXPECT_EQ(4u, ra.size());
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(0));
+	EXPECT_EQ(Rational(-3, 4), ra.retrieve(1));
+	EXPECT_EQ(Rational(5), ra.retrieve(2));
+	EXPECT_EQ(Rational(7), ra.retrieve(3));
+
+	ASSERT_EQ(3u, errors.size());
+	EXPECT_EQ(4u, errors[0].lineNumber);
+	EXPECT_EQ(STATUS_INVALID_FORMAT, errors[0].status);
+	EXPECT_EQ("4/x", errors[0].text);
+	EXPECT_EQ(6u, errors[1].lineNumber);
+	EXPECT_EQ(STATUS_DIVIDE_BY_ZERO, errors[1].status);
+	EXPECT_EQ(7u, errors[2].lineNumber);
+	EXPECT_EQ(STATUS_OVERFLOW, errors[2].status);
+}
+
+// test that a text split across threads loads in order, with the line numbers counted across chunks
+TEST(RationalLoaderTest, TestLoadParallel) {
+	std::ostringstream text;
+	const int lines = 100000;
+	for (int i = 1; i <= lines; i++) {
+		if (i % 25000 == 0) {
+			text << "bad" << i << "\n";
+		}
+		else {
+			text << i << "/" << (i % 7 + 1) << "\n";
+		}
+	}
+	std::string contents = text.str();
+
+	RationalArray ra;
+	ra.add(Rational(-1));
+	std::vector<RationalParseError> errors;
+	EXPECT_EQ((std::size_t)lines - 4, RationalLoader::load(contents.data(), contents.data() + contents.size(), ra, errors, 4));
+	EXPECT_EQ((std::size_t)lines - 3, ra.size());
+	EXPECT_EQ(Rational(-1), ra.retrieve(0));
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(1));
+	EXPECT_EQ(Rational(lines - 1, (lines - 1) % 7 + 1), ra.retrieve(lines - 4));
+
+	ASSERT_EQ(4u, errors.size());
+	for (int i = 0; i < 4; i++) {
+		EXPECT_EQ((std::size_t)(i + 1) * 25000, errors[i].lineNumber);
+	}
+}
+
+// test loading from a file, and a file that does not exist
+TEST(RationalLoaderTest, TestLoadFile) {
+	const char* fileName = "RationalLoaderTest.txt";
+	{
+		std::ofstream file(fileName);
+		file << "1/3\n2/3\n";
+	}
+
+	RationalArray ra;
+	std::vector<RationalParseError> errors;
+	EXPECT_EQ(2u, RationalLoader::loadFile(fileName, ra, errors));
+	EXPECT_EQ(Rational(2, 3), ra.retrieve(1));
+	EXPECT_TRUE(errors.empty());
+	std::remove(fileName);
+
+	try {
+		RationalLoader::loadFile(fileName, ra, errors);
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
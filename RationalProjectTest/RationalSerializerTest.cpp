@@ -0,0 +1,197 @@
+/*
+* File: RationalSerializerTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* RationalSerializer class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "RationalSerializer.h"
+
+#include <climits>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+using namespace rational;
+using namespace rational::exception;
+
+// test the varint and zigzag encodings
+TEST(RationalSerializerTest, TestVarint) {
+	EXPECT_EQ(0u, RationalSerializer::zigzagEncode<int>(0));
+	EXPECT_EQ(1u, RationalSerializer::zigzagEncode<int>(-1));
+	EXPECT_EQ(2u, RationalSerializer::zigzagEncode<int>(1));
+	EXPECT_EQ(0xFFFFFFFFu, RationalSerializer::zigzagEncode<int>(INT_MIN));
+	EXPECT_EQ(INT_MIN, RationalSerializer::zigzagDecode<int>(0xFFFFFFFFu));
+	EXPECT_EQ(INT_MAX, RationalSerializer::zigzagDecode<int>(0xFFFFFFFEu));
+
+	char buffer[RationalSerializer::maxVarintSize<std::uint64_t>()];
+	EXPECT_EQ(1, RationalSerializer::encodeVarint<unsigned int>(buffer, 127u) - buffer);
+	char* end = RationalSerializer::encodeVarint<unsigned int>(buffer, 300u);
+	EXPECT_EQ(2, end - buffer);
+	EXPECT_EQ("\xAC\x02", std::string(buffer, end));
+
+	// decoding, and the failures
+	const char* first = buffer;
+	unsigned int value = 0;
+	EXPECT_EQ(STATUS_OK, RationalSerializer::tryDecodeVarint<unsigned int>(first, end, value));
+	EXPECT_EQ(300u, value);
+	EXPECT_EQ(end, first);
+
+	first = buffer;
+	EXPECT_EQ(STATUS_INVALID_FORMAT, RationalSerializer::tryDecodeVarint<unsigned int>(first, end - 1, value));
+	EXPECT_EQ(buffer, first);
+
+	end = RationalSerializer::encodeVarint<std::uint64_t>(buffer, 1ull << 32);
+	EXPECT_EQ(STATUS_OVERFLOW, RationalSerializer::tryDecodeVarint<unsigned int>(first, end, value));
+	std::uint64_t wide = 0;
+	EXPECT_EQ(STATUS_OK, RationalSerializer::tryDecodeVarint<std::uint64_t>(first, end, wide));
+	EXPECT_EQ(1ull << 32, wide);
+}
+
+// test that single rationals round trip, through buffers and streams
+TEST(RationalSerializerTest, TestRational) {
+	Rational values[] = { Rational(0), Rational(1, 2), Rational(-3, 4), Rational(INT_MAX, 7), Rational(INT_MIN + 1, INT_MAX), Rational(INT_MIN) };
+	std::stringstream ss;
+	for (const Rational& value : values) {
+		char buffer[RationalSerializer::maxEncodedSize<int>()];
+		char* end = RationalSerializer::encode(buffer, value);
+		const char* first = buffer;
+		Rational decoded;
+		EXPECT_EQ(STATUS_OK, RationalSerializer::tryDecode(first, (const char*)end, decoded));
+		EXPECT_EQ(value, decoded);
+		EXPECT_EQ(end, first);
+
+		RationalSerializer::write(ss, value);
+	}
+
+	// -3/4 is two bytes
+	EXPECT_EQ(std::string("\x05\x04", 2), ss.str().substr(4, 2));
+
+	for (const Rational& value : values) {
+		Rational decoded;
+		RationalSerializer::read(ss, decoded);
+		EXPECT_EQ(value, decoded);
+	}
+
+	// wider instantiations
+	Rational64 big(LLONG_MIN, LLONG_MAX);
+	ss.str("");
+	ss.clear();
+	RationalSerializer::write(ss, big);
+	Rational64 decoded;
+	RationalSerializer::read(ss, decoded);
+	EXPECT_EQ(big, decoded);
+}
+
+// test decoding malformed rationals
+TEST(RationalSerializerTest, TestRationalInvalid) {
+	Rational result(5);
+	const char zero[] = { 2, 0 };
+	const char* first = zero;
+	EXPECT_EQ(STATUS_DIVIDE_BY_ZERO, RationalSerializer::tryDecode(first, zero + 2, result));
+
+	// the denominator does not fit in an int, though it fits the unsigned type
+	const char large[] = { 2, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, 0x0F };
+	first = large;
+	EXPECT_EQ(STATUS_OVERFLOW, RationalSerializer::tryDecode(first, large + sizeof(large), result));
+
+	// unreduced input is reduced
+	const char unreduced[] = { 4, 8 };
+	first = unreduced;
+	EXPECT_EQ(STATUS_OK, RationalSerializer::tryDecode(first, unreduced + 2, result));
+	EXPECT_EQ(1, result.getNumerator());
+	EXPECT_EQ(4, result.getDenominator());
+
+	std::stringstream ss(std::string("\x02", 1));
+	try {
+		// this should throw an exception
+		RationalSerializer::read(ss, result);
+		FAIL();
+	}
+	catch (InvalidFormatException &ex) {
+		std::cout << ex << std::endl;
+		EXPECT_TRUE(ss.fail());
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	ss.clear();
+	ss.str(std::string(zero, 2));
+	try {
+		// this should throw an exception
+		RationalSerializer::read(ss, result);
+		FAIL();
+	}
+	catch (DivideByZeroException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
+// test that arrays round trip, with and without a shared denominator
+TEST(RationalSerializerTest, TestArray) {
+	RationalArray shared;
+	RationalArray mixed;
+	for (int i = 0; i < 5000; i++) {
+		shared.add(Rational(2 * i + 1, 1000003));
+		mixed.add(Rational(i - 2500, i % 97 + 1));
+	}
+
+	std::stringstream ss;
+	RationalSerializer::write(ss, shared);
+	std::size_t sharedSize = ss.str().size();
+	RationalSerializer::write(ss, mixed);
+	EXPECT_EQ("RATA", ss.str().substr(0, 4));
+	EXPECT_EQ(RationalSerializer::FORMAT_VERSION, ss.str()[4]);
+	EXPECT_EQ(RationalSerializer::SHARED_DENOMINATOR, ss.str()[5]);
+	EXPECT_EQ(0, ss.str()[sharedSize + 5]);
+
+	// the elements are appended
+	RationalArray ra;
+	ra.add(Rational(-1));
+	EXPECT_EQ(5000u, RationalSerializer::read(ss, ra));
+	EXPECT_EQ(5001u, ra.size());
+	EXPECT_EQ(Rational(-1), ra.retrieve(0));
+	for (int i = 0; i < 5000; i++) {
+		EXPECT_EQ(shared.retrieve(i), ra.retrieve(i + 1));
+	}
+
+	RationalArray ra2;
+	EXPECT_EQ(5000u, RationalSerializer::read(ss, ra2));
+	for (int i = 0; i < 5000; i++) {
+		EXPECT_EQ(mixed.retrieve(i), ra2.retrieve(i));
+	}
+
+	// an empty array is just the header
+	RationalArray empty;
+	ss.str("");
+	ss.clear();
+	RationalSerializer::write(ss, empty);
+	EXPECT_EQ(7u, ss.str().size());
+	EXPECT_EQ(0u, RationalSerializer::read(ss, empty));
+	EXPECT_EQ(0u, empty.size());
+}
+
+// test reading malformed arrays
+TEST(RationalSerializerTest, TestArrayInvalid) {
+	RationalArray ra;
+	const char* inputs[] = { "RATB\x01\x00\x00", "RATA\x02\x00\x00", "RATA\x01\x02\x00", "RATA\x01\x00\x02\x02" };
+	const std::size_t sizes[] = { 7, 7, 7, 8 };
+	for (int i = 0; i < 4; i++) {
+		std::stringstream ss(std::string(inputs[i], sizes[i]));
+		try {
+			// this should throw an exception
+			RationalSerializer::read(ss, ra);
+			FAIL();
+		}
+		catch (InvalidFormatException &ex) {
+			std::cout << ex << std::endl;
+		}
+		catch (std::exception) {
+			FAIL();
+		}
+	}
+}
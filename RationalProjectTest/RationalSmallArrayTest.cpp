@@ -0,0 +1,109 @@
+/*
+* File: RationalSmallArrayTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* RationalSmallArray class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "RationalSmallArray.h"
+
+#include <utility>
+#include <gtest/gtest.h>
+using namespace rational;
+
+// true if the elements of the array are stored inside the object
+template<std::size_t N>
+static bool isInline(const RationalSmallArray<N>& ra) {
+	const char* object = reinterpret_cast<const char*>(&ra);
+	const char* elements = reinterpret_cast<const char*>(ra.data());
+	return elements >= object && elements < object + sizeof(ra);
+}
+
+// sum the elements through the base class
+static Rational sum(const RationalArray& ra) {
+	Rational result;
+	for (const Rational& rationalObj : ra) {
+		result += rationalObj;
+	}
+	return result;
+}
+
+// test inline storage, and growing past it
+TEST(RationalSmallArrayTest, TestInlineStorage) {
+	RationalSmallArray<4> ra;
+	EXPECT_EQ(4u, ra.capacity());
+	EXPECT_EQ(0u, ra.size());
+	EXPECT_TRUE(isInline(ra));
+
+	for (int i = 1; i <= 4; i++) {
+		ra.add(Rational(1, i));
+	}
+	EXPECT_TRUE(isInline(ra));
+	EXPECT_EQ(Rational(25, 12), sum(ra));
+
+	// the fifth element moves them all to the heap
+	ra.emplace_back(1, 5);
+	EXPECT_FALSE(isInline(ra));
+	EXPECT_TRUE(ra.capacity() > 4);
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(1));
+	EXPECT_EQ(Rational(1, 5), ra.retrieve(4));
+
+	// removing elements and shrinking returns them to the inline storage
+	ra.remove(0);
+	ra.shrink_to_fit();
+	EXPECT_TRUE(isInline(ra));
+	EXPECT_EQ(4u, ra.capacity());
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(0));
+	EXPECT_EQ(Rational(1, 5), ra.retrieve(3));
+
+	ra.clear();
+	EXPECT_TRUE(isInline(ra));
+	EXPECT_EQ(0u, ra.size());
+}
+
+// test copies and moves, between small arrays and RationalArrays
+TEST(RationalSmallArrayTest, TestCopyAndMove) {
+	RationalSmallArray<4> ra;
+	ra.add(Rational(1, 2));
+	ra.add(Rational(2, 3));
+
+	RationalSmallArray<4> copy(ra);
+	EXPECT_TRUE(isInline(copy));
+	EXPECT_EQ(ra, copy);
+	copy.replace(0, Rational(5));
+	EXPECT_EQ(Rational(1, 2), ra.retrieve(0));
+
+	// inline elements are moved one by one, and stay inline
+	RationalSmallArray<4> moved(std::move(copy));
+	EXPECT_TRUE(isInline(moved));
+	EXPECT_EQ(Rational(5), moved.retrieve(0));
+	EXPECT_EQ(0u, copy.size());
+
+	// a small array moved into a RationalArray
+	RationalArray plain;
+	plain = std::move(moved);
+	EXPECT_EQ(2u, plain.size());
+	EXPECT_EQ(Rational(2, 3), plain.retrieve(1));
+	EXPECT_TRUE(isInline(moved));
+
+	// heap storage is taken whole
+	RationalArray large;
+	for (int i = 0; i < 10; i++) {
+		large.add(Rational(i));
+	}
+	const Rational* elements = large.data();
+	RationalSmallArray<4> small;
+	small.add(Rational(7));
+	static_cast<RationalArray&>(small) = std::move(large);
+	EXPECT_EQ(elements, small.data());
+	EXPECT_EQ(10u, small.size());
+	EXPECT_EQ(Rational(9), small.retrieve(9));
+
+	// elements that fit are copied inline
+	RationalSmallArray<4> fromPlain(plain);
+	EXPECT_TRUE(isInline(fromPlain));
+	EXPECT_EQ(Rational(2, 3), fromPlain.retrieve(1));
+	fromPlain = ra;
+	EXPECT_EQ(Rational(1, 2), fromPlain.retrieve(0));
+}
@@ -9,6 +9,11 @@
 #include "Rational.h"
 #include "RationalException.h"
 
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 using namespace rational;
 using namespace rational::exception;
@@ -138,6 +143,26 @@ TEST_F(RationalTest, TestAssignment) {
 	EXPECT_EQ(Rational(r), r4);
 }
 
+// test that compound assignment returns a reference, and that rationals can be moved
+TEST_F(RationalTest, TestCompoundAssignmentChaining) {
+	Rational r(1, 4);
+	Rational& result = ((r += half) -= twoThirds) *= 6;
+
+	EXPECT_EQ(&r, &result);
+	EXPECT_EQ(Rational(1, 2), r);
+
+	(r /= half) = twoThirds;
+	EXPECT_EQ(twoThirds, r);
+
+	// moved-from big rationals are left valid
+	BigInteger large = BigInteger(std::numeric_limits<long long>::max()) * BigInteger(1000);
+	BigRational big = BigRational(large, BigInteger(11));
+	BigRational moved(std::move(big));
+	EXPECT_EQ(BigRational(large, BigInteger(11)), moved);
+	big = std::move(moved);
+	EXPECT_EQ(BigInteger(11), big.getDenominator());
+}
+
 // test set
 TEST_F(RationalTest, TestSet) {
 	Rational r;
@@ -188,6 +213,30 @@ TEST_F(RationalTest, TestSetDenominatorNegative) {
 	EXPECT_EQ(expected, r);
 }
 
+// test that the setters keep the rational in lowest terms
+TEST_F(RationalTest, TestSettersReduce) {
+	Rational r;
+	r.setNumerator(2);
+	r.setDenominator(4);
+	EXPECT_EQ(1, r.getNumerator());
+	EXPECT_EQ(2, r.getDenominator());
+
+	std::stringstream ss;
+	ss << r << ' ' << Rational(r) << ' ' << (r + Rational(0));
+	EXPECT_EQ("1/2 1/2 1/2", ss.str());
+
+	r.setNumerator(6);
+	EXPECT_EQ(Rational(3), r);
+	r.setDenominator(-9);
+	EXPECT_EQ(Rational(-1, 3), r);
+	EXPECT_EQ(Rational(1, 9), r.pow(2));
+
+	// a zero denominator is kept, so the rational stays invalid
+	r.setNumerator(0);
+	r.setDenominator(0);
+	EXPECT_EQ(0, r.getDenominator());
+}
+
 
 // test add
 TEST_F(RationalTest, TestAdd) {
@@ -435,6 +484,23 @@ TEST_F(RationalTest, TestPow) {
 	Rational actual = twoThirds.pow(-2);
 	Rational expected = Rational(9, 4);
 	EXPECT_EQ(expected, actual);
+
+	// powers are exact beyond the 53 bits of a double
+	Rational64 r2(3, 2);
+	EXPECT_EQ("4052555153018976267/549755813888", r2.pow(39).toString());
+	EXPECT_EQ("549755813888/4052555153018976267", r2.pow(-39).toString());
+
+	// overflow is reported
+	try {
+		Rational(3, 2).pow(21);
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
 }
 
 // test pow - exception
@@ -482,6 +548,21 @@ TEST_F(RationalTest, TestSquare) {
 
 	Rational r2(2, 3);
 	EXPECT_EQ(Rational(4,9), r2.square());
+	EXPECT_EQ("4/9", r2.square().toString());
+
+	// the largest square that fits
+	Rational r3(46340, 46339);
+	EXPECT_EQ(r3.pow(2), r3.square());
+	try {
+		Rational(46341).square();
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
 }
 
 // test inv
@@ -617,6 +698,61 @@ TEST_F(RationalTest, TestWrite) {
 	EXPECT_EQ(expected, actual);
 }
 
+// test the per-stream format manipulators
+TEST_F(RationalTest, TestStreamFormat) {
+	std::stringstream ss;
+	std::stringstream other;
+
+	// usedecimal applies to the next rational only, and only on its own stream
+	ss << usedecimal << half << ' ' << half;
+	other << half;
+	EXPECT_EQ("0.5 1/2", ss.str());
+	EXPECT_EQ("1/2", other.str());
+
+	// the sticky format stays until it is changed; usefraction overrides it once
+	ss.str("");
+	ss << setrationalformat(Rational::DECIMAL) << half << ' ' << usefraction << half << ' ' << twoThirds;
+	EXPECT_EQ("0.5 1/2 0.6666666666666666", ss.str());
+	EXPECT_EQ(Rational::DECIMAL, RationalFormat::getStickyFormat(ss));
+	EXPECT_EQ(Rational::FRACTION, RationalFormat::getStickyFormat(other));
+
+	ss.str("");
+	ss << setrationalformat(Rational::FRACTION) << half << ' ' << usedecimal << half;
+	EXPECT_EQ("1/2 0.5", ss.str());
+
+	// the format is shared by every instantiation
+	ss.str("");
+	ss << usedecimal << Rational64(3, 4) << ' ' << usedecimal << BigRational(1, 8);
+	EXPECT_EQ("0.75 0.125", ss.str());
+
+	// threads formatting into their own streams do not disturb each other
+	const int threadCount = 4;
+	std::vector<std::string> outputs(threadCount);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCount; t++) {
+		threads.emplace_back([t, &outputs]() {
+			std::ostringstream os;
+			if (t % 2 == 0) {
+				os << setrationalformat(Rational::DECIMAL);
+			}
+			for (int i = 0; i < 1000; i++) {
+				os << Rational(1, 4) << ' ';
+			}
+			outputs[t] = os.str();
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	for (int t = 0; t < threadCount; t++) {
+		std::string expected;
+		for (int i = 0; i < 1000; i++) {
+			expected += (t % 2 == 0) ? "0.25 " : "1/4 ";
+		}
+		EXPECT_EQ(expected, outputs[t]);
+	}
+}
+
 // test write - exception
 TEST_F(RationalTest, TestWriteDivideByZeroException) {
 	Rational r(1, 4);
@@ -653,6 +789,156 @@ TEST_F(RationalTest, TestToString) {
 	EXPECT_EQ(expected, actual);
 }
 
+// test formatting into a character buffer
+TEST_F(RationalTest, TestToChars) {
+	char buffer[Rational::MAX_CHARS];
+	std::to_chars_result result = twoThirds.toChars(buffer, buffer + sizeof(buffer));
+	EXPECT_EQ(std::errc(), result.ec);
+	EXPECT_EQ("2/3", std::string(buffer, result.ptr));
+
+	// decimals are the shortest text that reads back as the same double
+	result = twoThirds.toChars(buffer, buffer + sizeof(buffer), Rational::DECIMAL);
+	EXPECT_EQ("0.6666666666666666", std::string(buffer, result.ptr));
+	EXPECT_EQ(twoThirds.toDouble(), std::strtod(std::string(buffer, result.ptr).c_str(), nullptr));
+	result = Rational(1, 10).toChars(buffer, buffer + sizeof(buffer), Rational::DECIMAL);
+	EXPECT_EQ("0.1", std::string(buffer, result.ptr));
+
+	Rational smallest(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+	result = smallest.toChars(buffer, buffer + sizeof(buffer));
+	EXPECT_EQ("-2147483648/2147483647", std::string(buffer, result.ptr));
+
+	// too small a buffer is reported, as std::to_chars does
+	EXPECT_EQ(std::errc::value_too_large, twoThirds.toChars(buffer, buffer + 2).ec);
+	EXPECT_EQ(std::errc::value_too_large, twoThirds.toChars(buffer, buffer + 1).ec);
+	EXPECT_EQ(std::errc::value_too_large, twoThirds.toChars(buffer, buffer + 3, Rational::DECIMAL).ec);
+
+	// arbitrary precision values may outgrow MAX_CHARS, so toString falls back to building the string
+	BigInteger large = 1;
+	for (int i = 0; i < 700; i++) {
+		large = large * BigInteger(2);
+	}
+	BigRational big(large + BigInteger(1), large);
+	std::string text = big.toString();
+	EXPECT_LT(BigRational::MAX_CHARS, text.size());
+	EXPECT_EQ((large + BigInteger(1)).toString() + "/" + large.toString(), text);
+	std::stringstream ss;
+	ss << big;
+	EXPECT_EQ(text, ss.str());
+}
+
+// test the exact decimal expansions
+TEST_F(RationalTest, TestDecimalExpansion) {
+	EXPECT_EQ("0.(3)", Rational(1, 3).toRepeatingDecimalString());
+	EXPECT_EQ("0.1(6)", Rational(1, 6).toRepeatingDecimalString());
+	EXPECT_EQ("0.125", Rational(1, 8).toRepeatingDecimalString());
+	EXPECT_EQ("-1.(142857)", Rational(-8, 7).toRepeatingDecimalString());
+	EXPECT_EQ("-0.0(12)", Rational(-2, 165).toRepeatingDecimalString());
+	EXPECT_EQ("20", Rational(20).toRepeatingDecimalString());
+	EXPECT_EQ("0", Rational(0).toRepeatingDecimalString());
+	EXPECT_EQ("-2147483648", Rational(INT_MIN).toRepeatingDecimalString());
+	EXPECT_EQ("-1073741823.5", Rational(INT_MIN + 1, 2).toRepeatingDecimalString());
+
+	// the digits are truncated, not rounded
+	EXPECT_EQ("0.6666", twoThirds.toDecimalString(4));
+	EXPECT_EQ("-0.6666", twoThirds.negate().toDecimalString(4));
+	EXPECT_EQ("0", twoThirds.toDecimalString(0));
+	EXPECT_EQ("0.50000", half.toDecimalString(5));
+	EXPECT_EQ("7.00", Rational(7).toDecimalString(2));
+	EXPECT_EQ("0.33333333333333333333", Rational(1, 3).toDecimalString(20));
+
+	// the period is the order of 10 modulo the denominator, without the factors of 2 and 5
+	std::size_t preperiod, period;
+	Rational(1, 7).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(0u, preperiod);
+	EXPECT_EQ(6u, period);
+	Rational(1, 280).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(3u, preperiod);
+	EXPECT_EQ(6u, period);
+	// 2147483647 is prime, and 10 has order (2^31 - 2) / 11 modulo it -- too long for a buffer, so it is not generated
+	char buffer[64];
+	std::to_chars_result result = Rational(1, INT_MAX).toRepeatingDecimalChars(buffer, buffer + sizeof(buffer));
+	EXPECT_EQ(std::errc::value_too_large, result.ec);
+	result = Rational(1, 3).toRepeatingDecimalChars(buffer, buffer + 4);
+	EXPECT_EQ(std::errc::value_too_large, result.ec);
+	result = Rational(1, 3).toRepeatingDecimalChars(buffer, buffer + 5);
+	EXPECT_EQ("0.(3)", std::string(buffer, result.ptr));
+
+	// wider instantiations use the same long division
+	EXPECT_EQ("0." + std::string(18, '0') + "1084202", Rational64(1, LLONG_MAX).toDecimalString(25));
+	EXPECT_EQ("3.1415926535", Rational64(314159265358979LL, 100000000000000LL).toDecimalString(10));
+	EXPECT_EQ("0.(076923)", Rational128(1, 13).toRepeatingDecimalString());
+	EXPECT_EQ("0.(3)", BigRational(1, 3).toRepeatingDecimalString());
+	EXPECT_EQ("-0.1(6)", BigRational(-1, 6).toRepeatingDecimalString());
+	BigRational big(BigInteger(LLONG_MAX) * BigInteger(LLONG_MAX), 11);
+	EXPECT_EQ("7733690157294055986126991616748409204.(45)", big.toRepeatingDecimalString());
+
+	try {
+		// this should throw an exception
+		Rational invalid(1, 4);
+		invalid.setDenominator(0);
+		invalid.toDecimalString(3);
+		FAIL();
+	}
+	catch (DivideByZeroException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
+// test the period of large prime denominators -- it is found from the factors of the denominator, so it takes far less
+// time than stepping through the powers of 10
+TEST_F(RationalTest, TestDecimalPeriodLargePrime) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::size_t preperiod, period;
+	Rational(1, 2147483629).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(0u, preperiod);
+	EXPECT_EQ(2147483628u, period);
+	Rational(3, INT_MAX).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(195225786u, period);
+	Rational64(1, 1000000000000000003LL).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(166666666666666667u, period);
+	Rational64(7, 4 * 2305843009213693951LL).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(2u, preperiod);
+	EXPECT_EQ(1152921504606846975u, period);
+	std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+	EXPECT_LT(elapsed, std::chrono::seconds(1));
+
+	// (2^61 - 1) * (2^31 - 1) does not fit in 64 bits, so it is factored in the working type
+	Rational128(1, (__int128)2305843009213693951LL * INT_MAX).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(2305843009213693950u, period);
+	BigRational(BigInteger(1), BigInteger(2305843009213693951LL) * BigInteger(INT_MAX)).getDecimalPeriod(preperiod, period);
+	EXPECT_EQ(2305843009213693950u, period);
+
+	// the complete expansion is limited, rather than allocated
+	EXPECT_EQ("0.(142857)", Rational(1, 7).toRepeatingDecimalString(6));
+	EXPECT_EQ("0.1(6)", Rational(1, 6).toRepeatingDecimalString(2));
+	try {
+		// this should throw an exception
+		Rational(1, 2147483629).toRepeatingDecimalString();
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	try {
+		// this should throw an exception
+		Rational(1, 6).toRepeatingDecimalString(1);
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
 // test read
 TEST_F(RationalTest, TestRead) {
 	Rational actual;
@@ -720,6 +1006,77 @@ TEST_F(RationalTest, TestRead) {
 	
 }
 
+// test that extraction behaves like numeric extraction
+TEST_F(RationalTest, TestExtract) {
+	std::stringstream ss("  1/2\t-0.75\n 3 x 5");
+	Rational a, b, c, d;
+	ss >> a >> b >> c;
+	EXPECT_TRUE(ss.good());
+	EXPECT_EQ(half, a);
+	EXPECT_EQ(Rational(-3, 4), b);
+	EXPECT_EQ(Rational(3), c);
+
+	// a bad value sets failbit, and stops further extraction
+	ss >> d;
+	EXPECT_TRUE(ss.fail());
+	EXPECT_EQ(Rational(), d);
+	ss.clear();
+	ss >> d;
+	EXPECT_EQ(Rational(5), d);
+	EXPECT_TRUE(ss.eof());
+	EXPECT_FALSE(ss.fail());
+
+	// nothing left
+	ss >> d;
+	EXPECT_TRUE(ss.fail());
+
+	// values too long for the stack buffer still parse
+	std::string pi = "-3.14159265358979323846264338327950288419716939937510582097494459230781640628620899";
+	BigRational big, expected;
+	std::stringstream bigStream(pi + " 7");
+	bigStream >> big;
+	EXPECT_FALSE(bigStream.fail());
+	EXPECT_EQ(STATUS_OK, BigRational::tryParse(pi.data(), pi.data() + pi.size(), expected));
+	EXPECT_EQ(expected, big);
+	EXPECT_EQ(" 7", bigStream.str().substr(bigStream.tellg()));
+}
+
+// test that decimals are parsed exactly, and that parse errors are reported through the status
+TEST_F(RationalTest, TestParse) {
+	Rational result;
+	std::string text = "0.1";
+	EXPECT_EQ(STATUS_OK, Rational::tryParse(text.data(), text.data() + text.size(), result));
+	EXPECT_EQ(Rational(1, 10), result);
+
+	const char* valid[] = { "-.5", "1.50/0.25", "-2147483648", "007/14", "2.000000000000000000000", "-3/-6\t" };
+	const Rational expected[] = { Rational(-1, 2), Rational(6), Rational(std::numeric_limits<int>::min()), half, Rational(2), half };
+	for (int i = 0; i < 6; i++) {
+		EXPECT_EQ(STATUS_OK, Rational::tryParse(valid[i], valid[i] + std::strlen(valid[i]), result)) << valid[i];
+		EXPECT_EQ(expected[i], result) << valid[i];
+	}
+
+	const char* invalid[] = { "1-2", "--5", " 5", "1..2", "5/-", "+1", "1e5", "/2", "." };
+	for (const char* value : invalid) {
+		EXPECT_EQ(STATUS_INVALID_FORMAT, Rational::tryParse(value, value + std::strlen(value), result)) << value;
+	}
+
+	text = "2147483648";
+	EXPECT_EQ(STATUS_OVERFLOW, Rational::tryParse(text.data(), text.data() + text.size(), result));
+	text = "1/0.0";
+	EXPECT_EQ(STATUS_DIVIDE_BY_ZERO, Rational::tryParse(text.data(), text.data() + text.size(), result));
+
+	// wider types parse exactly too
+	Rational64 wide;
+	text = "123456789.123";
+	EXPECT_EQ(STATUS_OK, Rational64::tryParse(text.data(), text.data() + text.size(), wide));
+	EXPECT_EQ(Rational64(123456789123LL, 1000), wide);
+
+	BigRational big;
+	text = "-3.14159265358979323846264338327950288";
+	EXPECT_EQ(STATUS_OK, BigRational::tryParse(text.data(), text.data() + text.size(), big));
+	EXPECT_EQ("-19634954084936207740391521145496893/6250000000000000000000000000000000", big.toString());
+}
+
 // test read -- invalid format exception
 TEST_F(RationalTest, TestReadInvalidFormatException) {
 	Rational actual;
@@ -741,16 +1098,10 @@ TEST_F(RationalTest, TestReadInvalidFormatException) {
 		FAIL();
 	}
 
-	try {
-		ss2 >> actual2;
-		FAIL();
-	}
-	catch (InvalidFormatException &ex) {
-		std::cout << ex << std::endl;
-	}
-	catch (std::exception) {
-		FAIL();
-	}
+	// extraction sets failbit instead of throwing, and leaves the value unchanged
+	ss2 >> actual2;
+	EXPECT_TRUE(ss2.fail());
+	EXPECT_EQ(Rational(), actual2);
 
 	expected = "12.";
 	ss.clear();
@@ -769,16 +1120,10 @@ TEST_F(RationalTest, TestReadInvalidFormatException) {
 		FAIL();
 	}
 
-	try {
-		ss2 >> actual2;
-		FAIL();
-	}
-	catch (InvalidFormatException &ex) {
-		std::cout << ex << std::endl;
-	}
-	catch (std::exception) {
-		FAIL();
-	}
+	// extraction sets failbit instead of throwing, and leaves the value unchanged
+	ss2 >> actual2;
+	EXPECT_TRUE(ss2.fail());
+	EXPECT_EQ(Rational(), actual2);
 
 	expected = "12/12/43";
 	ss.clear();
@@ -797,16 +1142,10 @@ TEST_F(RationalTest, TestReadInvalidFormatException) {
 		FAIL();
 	}
 
-	try {
-		ss2 >> actual2;
-		FAIL();
-	}
-	catch (InvalidFormatException &ex) {
-		std::cout << ex << std::endl;
-	}
-	catch (std::exception) {
-		FAIL();
-	}
+	// extraction sets failbit instead of throwing, and leaves the value unchanged
+	ss2 >> actual2;
+	EXPECT_TRUE(ss2.fail());
+	EXPECT_EQ(Rational(), actual2);
 
 	expected = "abcd";
 	ss.clear();
@@ -825,16 +1164,10 @@ TEST_F(RationalTest, TestReadInvalidFormatException) {
 		FAIL();
 	}
 
-	try {
-		ss2 >> actual2;
-		FAIL();
-	}
-	catch (InvalidFormatException &ex) {
-		std::cout << ex << std::endl;
-	}
-	catch (std::exception) {
-		FAIL();
-	}
+	// extraction sets failbit instead of throwing, and leaves the value unchanged
+	ss2 >> actual2;
+	EXPECT_TRUE(ss2.fail());
+	EXPECT_EQ(Rational(), actual2);
 
 	expected = "";
 	ss.clear();
@@ -853,16 +1186,10 @@ TEST_F(RationalTest, TestReadInvalidFormatException) {
 		FAIL();
 	}
 
-	try {
-		ss2 >> actual2;
-		FAIL();
-	}
-	catch (InvalidFormatException &ex) {
-		std::cout << ex << std::endl;
-	}
-	catch (std::exception) {
-		FAIL();
-	}
+	// extraction sets failbit instead of throwing, and leaves the value unchanged
+	ss2 >> actual2;
+	EXPECT_TRUE(ss2.fail());
+	EXPECT_EQ(Rational(), actual2);
 
 	expected = "12/3 12";
 	ss.clear();
@@ -881,16 +1208,12 @@ TEST_F(RationalTest, TestReadInvalidFormatException) {
 		FAIL();
 	}
 
-	try {
-		ss2 >> actual2;
-		FAIL();
-	}
-	catch (InvalidFormatException &ex) {
-		std::cout << ex << std::endl;
-	}
-	catch (std::exception) {
-		FAIL();
-	}
+	// extraction stops at whitespace, so this is two values
+	Rational actual3;
+	ss2 >> actual2 >> actual3;
+	EXPECT_FALSE(ss2.fail());
+	EXPECT_EQ(Rational(4), actual2);
+	EXPECT_EQ(Rational(12), actual3);
 }
 
 // test read -- divide by zero exeption
@@ -913,16 +1236,10 @@ TEST_F(RationalTest, TestReadDivideByZeroException) {
 		FAIL();
 	}
 
-	try {
-		ss2 >> actual2;
-		FAIL();
-	}
-	catch (DivideByZeroException &ex) {
-		std::cout << ex << std::endl;
-	}
-	catch (std::exception) {
-		FAIL();
-	}
+	// extraction sets failbit instead of throwing, and leaves the value unchanged
+	ss2 >> actual2;
+	EXPECT_TRUE(ss2.fail());
+	EXPECT_EQ(Rational(), actual2);
 }
 
 // test to lowest terms - exception
@@ -1008,3 +1325,223 @@ TEST_F(RationalTest, TestCreateRationalDivideByZeroException) {
 		FAIL();
 	}
 }
+
+// test the 64-bit and 128-bit instantiations
+TEST_F(RationalTest, TestWideRationals) {
+	// values that overflow a 32-bit numerator
+	Rational64 r(3000000000LL, 7);
+	Rational64 r2(4000000000LL, 7);
+	EXPECT_EQ(Rational64(7000000000LL, 7), r + r2);
+	EXPECT_EQ(1000000000LL, (r + r2).getNumerator());
+	EXPECT_TRUE(r < r2);
+
+	// int literals convert to the wider type
+	Rational64 half64(1, 2);
+	EXPECT_EQ(Rational64(1), half64 * 2);
+	EXPECT_EQ("1/2", half64.toString());
+
+#ifdef __SIZEOF_INT128__
+	// 2^70 / 3 only fits in 128 bits
+	__int128 big = (__int128)1 << 70;
+	Rational128 r3(big, 3);
+	EXPECT_EQ("1180591620717411303424/3", r3.toString());
+	EXPECT_EQ(Rational128(big), r3 * 3);
+#endif
+}
+
+// test that overflow is reported instead of wrapping
+TEST_F(RationalTest, TestOverflowException) {
+	Rational max(2147483647);
+	try {
+		max + 1;
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	try {
+		Rational(1, 65536) * Rational(1, 65536);
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}
+
+// test that common factors are cancelled before multiplying, so only results that do not fit overflow
+TEST_F(RationalTest, TestCrossCancellation) {
+	// the unreduced products 65536 * 65536 do not fit in an int, but the result does
+	EXPECT_EQ(one, Rational(65536, 3) * Rational(3, 65536));
+	EXPECT_EQ(Rational(65536, 9), Rational(65536, 65537) * Rational(65537, 9));
+	EXPECT_EQ(Rational(3, 5), Rational(65536, 5) / Rational(65536, 3));
+	EXPECT_EQ(Rational(-1, 65536), Rational(-1, 65536) * Rational(65536, 65536));
+	EXPECT_EQ(half, Rational(3, 2147483647) * Rational(2147483647, 6));
+
+	// the sum only needs the denominator of its reduced form
+	EXPECT_EQ(Rational(1, 46341), Rational(1, 2 * 46341) + Rational(1, 2 * 46341));
+	EXPECT_EQ(Rational(2, 3), Rational(1, 2) + Rational(1, 6));
+
+	// the cross-multiplied numerator overflows when the denominators share a factor, although its reduced form fits
+	EXPECT_EQ(Rational(2103364025, 938739413), Rational(88701, 50854) + Rational(36653, 73838));
+	EXPECT_EQ(Rational64(11, 15), Rational64(1100000000000000003LL, 3000000000000000021LL) + Rational64(1833333333333333354LL, 5000000000000000035LL));
+	EXPECT_EQ(Rational64(11, 15), Rational64(1100000000000000003LL, 3000000000000000021LL) - Rational64(-1833333333333333354LL, 5000000000000000035LL));
+}
+
+// test the non-throwing arithmetic
+TEST_F(RationalTest, TestTryArithmetic) {
+	Rational result;
+	EXPECT_EQ(STATUS_OK, half.tryAdd(twoThirds, result));
+	EXPECT_EQ(Rational(7, 6), result);
+	EXPECT_EQ(STATUS_OK, half.trySubtract(twoThirds, result));
+	EXPECT_EQ(Rational(-1, 6), result);
+	EXPECT_EQ(STATUS_OK, half.tryMultiply(twoThirds, result));
+	EXPECT_EQ(Rational(1, 3), result);
+	EXPECT_EQ(STATUS_OK, half.tryDivide(Rational(-2, 3), result));
+	EXPECT_EQ(Rational(-3, 4), result);
+
+	// the result may be one of the operands
+	Rational sum(1, 4);
+	EXPECT_EQ(STATUS_OK, sum.tryAdd(sum, sum));
+	EXPECT_EQ(half, sum);
+
+	// failures leave the result untouched
+	result = one;
+	EXPECT_EQ(STATUS_DIVIDE_BY_ZERO, half.tryDivide(Rational(0), result));
+	EXPECT_EQ(STATUS_OVERFLOW, Rational(2147483647).tryAdd(one, result));
+	EXPECT_EQ(STATUS_OVERFLOW, Rational(1, 65536).tryMultiply(Rational(1, 65536), result));
+	EXPECT_EQ(one, result);
+
+	Rational invalid(1, 4);
+	invalid.setDenominator(0);
+	EXPECT_EQ(STATUS_DIVIDE_BY_ZERO, half.tryAdd(invalid, result));
+
+	EXPECT_EQ(STATUS_OK, Rational::tryCreate(6, -8, result));
+	EXPECT_EQ(Rational(-3, 4), result);
+	EXPECT_EQ(STATUS_DIVIDE_BY_ZERO, Rational::tryCreate(1, 0, result));
+	EXPECT_EQ(STATUS_OVERFLOW, Rational::tryCreate(std::numeric_limits<int>::min(), -1, result));
+}
+
+// test exact accumulation with the arbitrary-precision rational
+TEST_F(RationalTest, TestBigRational) {
+	// harmonic sum -- the denominators grow well past 64 bits
+	BigRational sum;
+	for (int i = 1; i <= 60; i++) {
+		sum += BigRational(1, i);
+	}
+	EXPECT_FALSE(sum.getDenominator().isSmall());
+
+	// subtract the terms back out in the opposite order
+	for (int i = 60; i >= 1; i--) {
+		sum -= BigRational(1, i);
+	}
+	EXPECT_EQ(BigRational(0), sum);
+
+	// small values behave like Rational
+	BigRational r(4, 6);
+	EXPECT_EQ("2/3", r.toString());
+	EXPECT_TRUE(r.getNumerator().isSmall());
+	EXPECT_EQ(BigRational(1, 3), r / 2);
+}
+
+// test three way comparison, including values whose common denominator does not fit
+TEST_F(RationalTest, TestCompare) {
+	EXPECT_EQ(-1, half.compare(twoThirds));
+	EXPECT_EQ(1, twoThirds.compare(half));
+	EXPECT_EQ(0, half.compare(Rational(2, 4)));
+	EXPECT_EQ(-1, Rational(-2, 3).compare(Rational(1, 3)));
+
+	// the LCM of these denominators overflows int, but the comparison is exact
+	Rational r(2147483646, 2147483647);
+	Rational r2(2147483645, 2147483646);
+	EXPECT_EQ(1, r.compare(r2));
+	EXPECT_TRUE(r2 < r);
+	EXPECT_TRUE(r >= r2);
+	EXPECT_TRUE(r != r2);
+	EXPECT_TRUE(r.greaterThan(r2));
+
+	// 64-bit values are compared in a 128-bit product (or by halves)
+	Rational64 r3(9223372036854775806LL, 9223372036854775807LL);
+	Rational64 r4(9223372036854775805LL, 9223372036854775806LL);
+	EXPECT_TRUE(r4 < r3);
+	EXPECT_TRUE(r3.negate() < r4.negate());
+	EXPECT_EQ(0, r3.compare(r3));
+	// the portable split multiplication agrees
+	EXPECT_EQ(1, (compareProductsWide<std::int64_t, std::uint64_t>(r3.getNumerator(), r4.getDenominator(), r4.getNumerator(), r3.getDenominator())));
+	EXPECT_EQ(-1, (compareProductsWide<std::int64_t, std::uint64_t>(-r3.getNumerator(), r4.getDenominator(), -r4.getNumerator(), r3.getDenominator())));
+
+#ifdef __SIZEOF_INT128__
+	__int128 max = ~((unsigned __int128)1 << 127);
+	Rational128 r5(max - 1, max);
+	Rational128 r6(max - 2, max - 1);
+	EXPECT_TRUE(r6 < r5);
+	EXPECT_TRUE(r5.negate() < r6.negate());
+#endif
+
+#ifdef __cpp_impl_three_way_comparison
+	EXPECT_TRUE((half <=> twoThirds) < 0);
+	EXPECT_TRUE((half <=> Rational(2, 4)) == 0);
+#endif
+}
+
+// test exact conversion from double, and the bounded-denominator approximation
+TEST_F(RationalTest, TestDoubleConversion) {
+	// exactly representable values convert exactly
+	EXPECT_EQ("11/4", Rational(2.75).toString());
+	EXPECT_EQ("-3/1024", Rational(-3.0 / 1024).toString());
+	EXPECT_EQ("1/3", Rational(1.0 / 3).toString());
+	EXPECT_EQ("3602879701896397/36028797018963968", Rational64::fromDouble(0.1).toString());
+	EXPECT_EQ("3602879701896397/36028797018963968", BigRational(0.1).toString());
+
+	// values that do not fit use the closest rational that does
+	EXPECT_EQ("1/10", Rational(0.1).toString());
+	EXPECT_EQ("-3333/5000", Rational(-0.6666).toString());
+	EXPECT_EQ(Rational(0), Rational(1e-12));
+
+	// the exact conversion reports values that do not fit
+	try {
+		Rational::fromDouble(0.1);
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	try {
+		Rational r(1e10);
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	try {
+		Rational r(std::numeric_limits<double>::quiet_NaN());
+		FAIL();
+	}
+	catch (InvalidArgumentException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	// bounded denominators
+	EXPECT_EQ(Rational(355, 113), Rational::fromDouble(3.141592653589793, 1000));
+	EXPECT_EQ(Rational(311, 99), Rational::fromDouble(3.141592653589793, 100));
+	EXPECT_EQ(Rational(-1, 3), Rational::fromDouble(-0.333, 10));
+	EXPECT_EQ(Rational64(1, 10), Rational64::fromDouble(0.1, 1000000));
+	EXPECT_EQ(BigRational(2, 3), BigRational::fromDouble(0.6666, 10));
+}
@@ -0,0 +1,101 @@
+/*
+* File: RationalTokenizerTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* RationalTokenizer and RationalStreamTokenizer class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "RationalTokenizer.h"
+
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+using namespace rational;
+
+// test tokenizing a character range
+TEST(RationalTokenizerTest, TestRange) {
+	std::string text = " 1/2, -0.75,,3\n4/x\t1/0  7 ";
+	RationalTokenizer tokens(text.data(), text.data() + text.size());
+	Rational value;
+
+	EXPECT_FALSE(tokens.atEnd());
+	EXPECT_EQ(STATUS_OK, tokens.next(value));
+	EXPECT_EQ(Rational(1, 2), value);
+	EXPECT_EQ("1/2", tokens.token());
+	EXPECT_EQ(STATUS_OK, tokens.next(value));
+	EXPECT_EQ(Rational(-3, 4), value);
+	EXPECT_EQ(STATUS_OK, tokens.next(value));
+	EXPECT_EQ(Rational(3), value);
+
+	// failures consume the value, and the next one is read normally
+	EXPECT_EQ(STATUS_INVALID_FORMAT, tokens.next(value));
+	EXPECT_EQ("4/x", tokens.token());
+	EXPECT_EQ(STATUS_DIVIDE_BY_ZERO, tokens.next(value));
+	EXPECT_EQ(STATUS_OK, tokens.next(value));
+	EXPECT_EQ(Rational(7), value);
+
+	EXPECT_TRUE(tokens.atEnd());
+	EXPECT_EQ(text.data() + text.size(), tokens.position());
+	EXPECT_EQ(STATUS_INVALID_FORMAT, tokens.next(value));
+	EXPECT_EQ(Rational(7), value);
+}
+
+// test custom delimiters, and other instantiations
+TEST(RationalTokenizerTest, TestDelimiters) {
+	std::string text = "1/3;2/3;;9223372036854775807";
+	RationalTokenizer tokens(text.data(), text.data() + text.size(), ";");
+	Rational64 value;
+	Rational64 sum;
+	int count = 0;
+	while (!tokens.atEnd()) {
+		EXPECT_EQ(STATUS_OK, tokens.next(value));
+		if (count++ < 2) {
+			sum += value;
+		}
+	}
+	EXPECT_EQ(3, count);
+	EXPECT_EQ(Rational64(1), sum);
+	EXPECT_EQ(Rational64(9223372036854775807LL), value);
+
+	// the same text overflows an int
+	RationalTokenizer intTokens(text.data(), text.data() + text.size(), ";");
+	Rational intValue;
+	for (int i = 0; i < 2; i++) {
+		EXPECT_EQ(STATUS_OK, intTokens.next(intValue));
+	}
+	EXPECT_EQ(STATUS_OVERFLOW, intTokens.next(intValue));
+
+	// spaces are not delimiters here, so they are part of a value
+	std::string spaced = "1 2,3";
+	RationalTokenizer commaTokens(spaced.data(), spaced.data() + spaced.size(), ",");
+	EXPECT_EQ(STATUS_INVALID_FORMAT, commaTokens.next(intValue));
+	EXPECT_EQ("1 2", commaTokens.token());
+}
+
+// test tokenizing a stream
+TEST(RationalTokenizerTest, TestStream) {
+	std::stringstream ss("1/2, -0.75\n\n4/x,  12.5/2.5,");
+	RationalStreamTokenizer tokens(ss);
+	Rational value;
+
+	EXPECT_EQ(STATUS_OK, tokens.next(value));
+	EXPECT_EQ(Rational(1, 2), value);
+	EXPECT_EQ(STATUS_OK, tokens.next(value));
+	EXPECT_EQ(Rational(-3, 4), value);
+	EXPECT_EQ(STATUS_INVALID_FORMAT, tokens.next(value));
+	EXPECT_EQ("4/x", tokens.token());
+	EXPECT_FALSE(tokens.atEnd());
+	EXPECT_EQ(STATUS_OK, tokens.next(value));
+	EXPECT_EQ(Rational(5), value);
+	EXPECT_TRUE(tokens.atEnd());
+	EXPECT_TRUE(ss.eof());
+	EXPECT_EQ(STATUS_INVALID_FORMAT, tokens.next(value));
+
+	// a value at the very end of the stream
+	std::stringstream last("8/6");
+	RationalStreamTokenizer lastTokens(last);
+	EXPECT_EQ(STATUS_OK, lastTokens.next(value));
+	EXPECT_EQ(Rational(4, 3), value);
+	EXPECT_TRUE(lastTokens.atEnd());
+}
@@ -0,0 +1,106 @@
+/*
+* File: UnreducedRationalTest.cpp
+* Author: Ryan Johnson
+* Email: johnsonrw82@csu.fullerton.edu
+*
+* UnreducedRational class unit tests - written for use with the GoogleTest framework
+*/
+
+#include "UnreducedRational.h"
+#include "RationalException.h"
+
+#include <gtest/gtest.h>
+using namespace rational;
+using namespace rational::exception;
+
+// a GCD policy that counts how many GCDs are computed
+struct CountingGcd {
+	static inline int count = 0;
+
+	template<typename IntT>
+	static IntT gcd(const IntT a, const IntT b) {
+		count++;
+		return BinaryGcd::gcd(a, b);
+	}
+};
+
+// test that a chain of operations gives the same value as the reduced arithmetic
+TEST(UnreducedRationalTest, TestChain) {
+	Rational a(1, 2);
+	Rational b(2, 3);
+	Rational c(3, 4);
+	Rational d(5, 6);
+
+	UnreducedRational sum = UnreducedRational(a) + UnreducedRational(b) * c - d;
+	EXPECT_EQ(a + b * c - d, sum.toRational());
+	EXPECT_EQ(Rational(1, 6), sum.toRational());
+
+	UnreducedRational quotient = UnreducedRational(a) / b / -3;
+	EXPECT_EQ(Rational(-1, 4), quotient.toRational());
+	EXPECT_LT(0, quotient.getDenominator());
+
+	// an equal denominator only adds the numerators
+	UnreducedRational halves(1, 2);
+	halves += Rational(3, 2);
+	EXPECT_EQ(4, halves.getNumerator());
+	EXPECT_EQ(2, halves.getDenominator());
+	halves.reduce();
+	EXPECT_EQ(2, halves.getNumerator());
+	EXPECT_EQ(1, halves.getDenominator());
+}
+
+// test that the chain reduces only when it is materialized
+TEST(UnreducedRationalTest, TestSingleReduction) {
+	typedef BasicRational<int, CountingGcd> CountingRational;
+	typedef BasicUnreducedRational<int, CountingGcd> CountingUnreduced;
+	CountingRational a(1, 2);
+	CountingRational b(1, 3);
+	CountingRational expected(a);
+	for (int i = 0; i < 5; i++) {
+		expected = (expected + b) * a;
+	}
+
+	CountingGcd::count = 0;
+	CountingUnreduced sum(a);
+	for (int i = 0; i < 5; i++) {
+		sum += b;
+		sum *= a;
+	}
+	EXPECT_EQ(0, CountingGcd::count);
+
+	CountingRational result = sum.toRational();
+	EXPECT_EQ(1, CountingGcd::count);
+	EXPECT_EQ(expected, result);
+	EXPECT_EQ(CountingRational(65, 192), result);
+}
+
+// test that a step that would overflow reduces first, and only reports overflow when the reduced value does not fit
+TEST(UnreducedRationalTest, TestOverflow) {
+	// the unreduced denominator 65536 * 65536 does not fit, but the reduced value does
+	UnreducedRational product(65536, 65536);
+	product *= UnreducedRational(65536, 65536);
+	EXPECT_EQ(Rational(1), product.toRational());
+
+	try {
+		UnreducedRational big(2147483647);
+		big += 1;
+		FAIL();
+	}
+	catch (OverflowException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+
+	try {
+		UnreducedRational(1, 2) / 0;
+		FAIL();
+	}
+	catch (DivideByZeroException &ex) {
+		std::cout << ex << std::endl;
+	}
+	catch (std::exception) {
+		FAIL();
+	}
+}